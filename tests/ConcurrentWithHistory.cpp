@@ -0,0 +1,134 @@
+/**
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE ConcurrentWithHistory
+
+// Internal Includes
+#include <util/ConcurrentWithHistory.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <boost/thread/thread.hpp>
+
+// Standard includes
+#include <vector>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+BOOST_AUTO_TEST_CASE(ValueConstructionPOD) {
+	ConcurrentWithHistory<int> a(5, 3);
+	BOOST_CHECK_EQUAL(a.current(), 5);
+	BOOST_CHECK_EQUAL(a.previous(), 3);
+
+	ConcurrentWithHistory<int>::Snapshot snap = a.read();
+	BOOST_CHECK_EQUAL(snap.current(), 3);
+	BOOST_CHECK_EQUAL(snap.previous(), 3);
+	BOOST_CHECK_EQUAL(snap.frame(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(AdvanceByCopyPOD) {
+	ConcurrentWithHistory<int> a(5);
+	a.advanceByCopy();
+	BOOST_CHECK_EQUAL(a.current(), 5);
+	BOOST_CHECK_EQUAL(a.previous(), 5);
+	a.current() = 7;
+	a.advanceByCopy();
+	BOOST_CHECK_EQUAL(a.current(), 7);
+	BOOST_CHECK_EQUAL(a.previous(), 7);
+
+	ConcurrentWithHistory<int>::Snapshot snap = a.read();
+	BOOST_CHECK_EQUAL(snap.current(), 7);
+	BOOST_CHECK_EQUAL(snap.previous(), 5);
+	BOOST_CHECK_EQUAL(snap.frame(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(SwapPOD) {
+	ConcurrentWithHistory<int> a(5);
+	a.swap();
+	BOOST_CHECK_EQUAL(a.previous(), 5);
+	a.current() = 9;
+	a.swap();
+	BOOST_CHECK_EQUAL(a.previous(), 9);
+
+	ConcurrentWithHistory<int>::Snapshot snap = a.read();
+	BOOST_CHECK_EQUAL(snap.current(), 9);
+	BOOST_CHECK_EQUAL(snap.previous(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(SnapshotSurvivesAdvance) {
+	ConcurrentWithHistory<std::vector<int>, 5> a(std::vector<int>(3, 1));
+	a.advanceByCopy();
+	ConcurrentWithHistory<std::vector<int>, 5>::Snapshot snap = a.read();
+	for (int i = 2; i < 20; ++i) {
+		a.current().assign(3, i);
+		a.advanceByCopy();
+	}
+	BOOST_CHECK_EQUAL(snap.current().size(), 3u);
+	BOOST_CHECK_EQUAL(snap.current()[0], 1);
+	BOOST_CHECK_EQUAL(a.read().current()[0], 19);
+	BOOST_CHECK_EQUAL(a.read().previous()[0], 18);
+}
+
+BOOST_AUTO_TEST_CASE(SnapshotCopies) {
+	ConcurrentWithHistory<int, 3> a(1);
+	a.advanceByCopy();
+	{
+		ConcurrentWithHistory<int, 3>::Snapshot snap = a.read();
+		ConcurrentWithHistory<int, 3>::Snapshot copy(snap);
+		copy = a.read();
+		BOOST_CHECK_EQUAL(copy.current(), 1);
+	}
+	/// With only three slots, advancing requires all snapshots be released.
+	a.current() = 2;
+	a.advanceByCopy();
+	BOOST_CHECK_EQUAL(a.read().current(), 2);
+}
+
+namespace {
+	/// Frames are vectors whose elements all equal the frame number
+	typedef ConcurrentWithHistory<std::vector<int>, 16> History;
+
+	struct Reader {
+		Reader(History & h, bool & ok) : _h(h), _ok(ok) {}
+		void operator()() {
+			for (int n = 0; n < 20000; ++n) {
+				History::Snapshot snap = _h.read();
+				const int cur = snap.current()[0];
+				const int prev = snap.previous()[0];
+				if (cur != static_cast<int>(snap.frame()) || (prev != cur - 1 && !(cur == 0 && prev == 0))) {
+					_ok = false;
+				}
+				for (unsigned i = 0; i < snap.current().size(); ++i) {
+					if (snap.current()[i] != cur || snap.previous()[i] != prev) {
+						_ok = false;
+					}
+				}
+			}
+		}
+		History & _h;
+		bool & _ok;
+	};
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedReadersSeeConsistentPairs) {
+	History h(std::vector<int>(64, 0), std::vector<int>(64, 0));
+	bool ok1 = true;
+	bool ok2 = true;
+	boost::thread r1((Reader(h, ok1)));
+	boost::thread r2((Reader(h, ok2)));
+	for (int frame = 1; frame < 20000; ++frame) {
+		h.current().assign(64, frame);
+		h.swap();
+	}
+	r1.join();
+	r2.join();
+	BOOST_CHECK(ok1);
+	BOOST_CHECK(ok2);
+}
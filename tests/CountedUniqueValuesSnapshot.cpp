@@ -0,0 +1,199 @@
+/** @date	2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE CountedUniqueValuesSnapshot tests
+
+// Internal Includes
+#include <util/CountedUniqueValuesSnapshot.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Standard includes
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <cstddef>
+#include <stdexcept>
+
+
+using namespace boost::unit_test;
+using namespace util;
+using std::string;
+
+/// Save a small snapshot, then overwrite one header field
+void writeCorruptSnapshot(const char * filename, std::size_t fieldOffset, stdint::uint64_t fieldValue) {
+	CountedUniqueValues<string> a;
+	a.store("foo");
+	a.store("bar");
+	a.store("baz");
+	saveSnapshot(a, filename);
+	std::fstream f(filename, std::ios::in | std::ios::out | std::ios::binary);
+	f.seekp(fieldOffset);
+	f.write(reinterpret_cast<const char *>(&fieldValue), sizeof(fieldValue));
+}
+
+BOOST_AUTO_TEST_CASE(EmptyRoundTrip) {
+	CountedUniqueValues<string> a;
+	saveSnapshot(a, "cuv_empty.snapshot");
+	CountedUniqueValuesSnapshot<string> snap("cuv_empty.snapshot");
+	BOOST_CHECK_EQUAL(snap.size(), 0);
+	BOOST_CHECK_EQUAL(snap.find("foo"), snap.size());
+	std::remove("cuv_empty.snapshot");
+}
+
+BOOST_AUTO_TEST_CASE(StringRoundTrip) {
+	CountedUniqueValues<string> a;
+	a.store("foo");
+	a.store("bar");
+	a.store("");
+	a.store("a somewhat longer string");
+	saveSnapshot(a, "cuv_string.snapshot");
+
+	CountedUniqueValuesSnapshot<string> snap("cuv_string.snapshot");
+	BOOST_REQUIRE_EQUAL(snap.size(), a.size());
+	for (unsigned int i = 0; i < a.size(); ++i) {
+		BOOST_CHECK_EQUAL(snap[i], a[i]);
+		BOOST_CHECK_EQUAL(snap.get(i).str(), a.get(i));
+	}
+	BOOST_CHECK_THROW(snap.get(a.size()), std::out_of_range);
+	std::remove("cuv_string.snapshot");
+}
+
+BOOST_AUTO_TEST_CASE(StringLookup) {
+	CountedUniqueValues<string> a;
+	unsigned int fooID = a.store("foo");
+	unsigned int barID = a.store("bar");
+	unsigned int emptyID = a.store("");
+	saveSnapshot(a, "cuv_lookup.snapshot");
+
+	CountedUniqueValuesSnapshot<string> snap("cuv_lookup.snapshot");
+	BOOST_CHECK_EQUAL(snap.find("foo"), fooID);
+	BOOST_CHECK_EQUAL(snap.find("bar"), barID);
+	BOOST_CHECK_EQUAL(snap.find(""), emptyID);
+	BOOST_CHECK_EQUAL(snap.find("baz"), snap.size());
+	BOOST_CHECK_EQUAL(snap.find("fo"), snap.size());
+	std::remove("cuv_lookup.snapshot");
+}
+
+BOOST_AUTO_TEST_CASE(PODLookup) {
+	CountedUniqueValues<int> a;
+	for (int i = 0; i < 1000; ++i) {
+		a.store(i * 7);
+	}
+	saveSnapshot(a, "cuv_pod.snapshot");
+
+	CountedUniqueValuesSnapshot<int> snap("cuv_pod.snapshot");
+	BOOST_REQUIRE_EQUAL(snap.size(), 1000);
+	for (int i = 0; i < 1000; ++i) {
+		BOOST_CHECK_EQUAL(snap[i], i * 7);
+		BOOST_CHECK_EQUAL(snap.find(i * 7), i);
+	}
+	BOOST_CHECK_EQUAL(snap.find(1), snap.size());
+	std::remove("cuv_pod.snapshot");
+}
+
+BOOST_AUTO_TEST_CASE(LoadIntoContainer) {
+	CountedUniqueValues<string> a;
+	a.store("foo");
+	a.store("bar");
+	saveSnapshot(a, "cuv_load.snapshot");
+
+	CountedUniqueValues<string> b;
+	loadSnapshot("cuv_load.snapshot", b);
+	BOOST_REQUIRE_EQUAL(b.size(), 2);
+	BOOST_CHECK_EQUAL(b.store("foo"), 0);
+	BOOST_CHECK_EQUAL(b.store("bar"), 1);
+	BOOST_CHECK_EQUAL(b.store("baz"), 2);
+	std::remove("cuv_load.snapshot");
+}
+
+BOOST_AUTO_TEST_CASE(RejectsMismatchedType) {
+	CountedUniqueValues<string> a;
+	a.store("foo");
+	saveSnapshot(a, "cuv_mismatch.snapshot");
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<int> snap("cuv_mismatch.snapshot"), std::runtime_error);
+	std::remove("cuv_mismatch.snapshot");
+}
+
+BOOST_AUTO_TEST_CASE(RejectsMissingFile) {
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap("cuv_does_not_exist.snapshot"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(RejectsMalformedHeader) {
+	typedef detail::CUVSnapshotHeader Header;
+	const char * filename = "cuv_malformed.snapshot";
+	const stdint::uint64_t huge = ~stdint::uint64_t(0);
+	const std::size_t fields[] = {offsetof(Header, count), offsetof(Header, tableSize), offsetof(Header, offsetsStart),
+	                              offsetof(Header, tableStart), offsetof(Header, valuesStart), offsetof(Header, valuesBytes)
+	                             };
+	for (std::size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+		/// Huge values wrap naive end-of-section sums back into range
+		writeCorruptSnapshot(filename, fields[i], huge);
+		BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+		writeCorruptSnapshot(filename, fields[i], huge - 15);
+		BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	}
+	/// Not a power of two, and too small to leave an empty slot
+	writeCorruptSnapshot(filename, offsetof(Header, tableSize), 6);
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	writeCorruptSnapshot(filename, offsetof(Header, tableSize), 2);
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	/// Misaligned and out-of-order sections
+	writeCorruptSnapshot(filename, offsetof(Header, offsetsStart), sizeof(Header) + 4);
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	writeCorruptSnapshot(filename, offsetof(Header, tableStart), sizeof(Header));
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+
+	/// Still in order and inside the file, only misaligned
+	const std::size_t offsetsStart = (sizeof(Header) + 7) / 8 * 8;
+	const stdint::uint64_t valuesStart = offsetsStart + (4 + detail::cuvSnapshotTableSize(3)) * sizeof(stdint::uint64_t);
+	writeCorruptSnapshot(filename, offsetof(Header, valuesStart), valuesStart);
+	BOOST_CHECK_NO_THROW(CountedUniqueValuesSnapshot<string> snap(filename));
+	writeCorruptSnapshot(filename, offsetof(Header, valuesStart), valuesStart + 4);
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	std::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(RejectsCorruptOffsets) {
+	typedef detail::CUVSnapshotHeader Header;
+	typedef stdint::uint64_t u64;
+	const char * filename = "cuv_offsets.snapshot";
+	const std::size_t offsets = (sizeof(Header) + 7) / 8 * 8;
+	/// Past the end of the blob, and out of order
+	writeCorruptSnapshot(filename, offsets + sizeof(u64), ~u64(0));
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	writeCorruptSnapshot(filename, offsets + 3 * sizeof(u64), 100);
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	writeCorruptSnapshot(filename, offsets + 2 * sizeof(u64), 1);
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	writeCorruptSnapshot(filename, offsets, 1);
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap(filename), std::runtime_error);
+	/// Fixed-size values must span exactly their size
+	CountedUniqueValues<double> a;
+	a.store(1.5);
+	a.store(2.5);
+	saveSnapshot(a, filename);
+	{
+		std::fstream f(filename, std::ios::in | std::ios::out | std::ios::binary);
+		f.seekp(offsets + sizeof(u64));
+		const u64 misaligned = 4;
+		f.write(reinterpret_cast<const char *>(&misaligned), sizeof(misaligned));
+	}
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<double> snap(filename), std::runtime_error);
+	std::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(RejectsEmptyFile) {
+	{
+		std::ofstream empty("cuv_empty_file.snapshot", std::ios::out | std::ios::binary | std::ios::trunc);
+	}
+	BOOST_CHECK_THROW(CountedUniqueValuesSnapshot<string> snap("cuv_empty_file.snapshot"), std::runtime_error);
+	std::remove("cuv_empty_file.snapshot");
+}
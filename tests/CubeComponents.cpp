@@ -13,9 +13,15 @@
 
 // Library/third-party includes
 #include <BoostTestTargetConfig.h>
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/is_polymorphic.hpp>
 
 // Standard includes
-// - none
+#include <bitset>
+#include <set>
+#include <algorithm>
+#include <sstream>
 
 using namespace boost::unit_test;
 
@@ -106,3 +112,166 @@ BOOST_AUTO_TEST_CASE(FaceVertexIdentity) {
 		}
 	}
 }
+
+BOOST_AUTO_TEST_CASE(VertexTables) {
+	for (unsigned int v = 0; v < CUBE_CORNER_COUNT; ++v) {
+		const Cube::Vertex vert = Cube::Vertex(Cube::IDType(v));
+		for (unsigned int m = 0; m < 3; ++m) {
+			/// Neighbors differ in exactly bit m
+			BOOST_CHECK_EQUAL(vert.getNeighbor(m).getBitset(), Cube::Vertex::BitsetType(v).flip(m));
+			BOOST_CHECK_EQUAL(vert.getNeighborIDs()[m], vert.getNeighbor(m).getID());
+
+			/// The face with fixed bit m holds this vertex
+			const Cube::Face face = vert.getFace(m);
+			BOOST_CHECK_EQUAL(face.getFixedBitIndex(), m);
+			BOOST_CHECK_EQUAL(face.getID(), vert.getFaceIDs()[m]);
+			const Cube::IDType * faceVerts = face.getVertexIDs();
+			BOOST_CHECK(std::find(faceVerts, faceVerts + 4, v) != faceVerts + 4);
+
+			/// The edge along axis m joins this vertex and neighbor m
+			const Cube::IDType e = vert.getEdgeIDs()[m];
+			BOOST_CHECK_EQUAL(e / 4, m);
+			const std::set<unsigned int> ends(util::CubeTables::edgeVertices[e], util::CubeTables::edgeVertices[e] + 2);
+			BOOST_CHECK(ends.count(v) && ends.count(vert.getNeighbor(m).getID()));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(FaceTables) {
+	for (unsigned int i = 0; i < CUBE_FACE_COUNT; ++i) {
+		const Cube::Face face = Cube::Face(Cube::IDType(i));
+		for (unsigned int k = 0; k < 4; ++k) {
+			const Cube::Vertex vert = face.getFaceVertex(k).getCubeVertex();
+			BOOST_CHECK_EQUAL(face.getVertexIDs()[k], vert.getID());
+			BOOST_CHECK_EQUAL(vert.getBitset()[face.getFixedBitIndex()], face.getFixedBitValue());
+		}
+		/// Edges go around the face: each shares a vertex with the next
+		for (unsigned int j = 0; j < 4; ++j) {
+			const unsigned char * a = util::CubeTables::edgeVertices[face.getEdgeIDs()[j]];
+			const unsigned char * b = util::CubeTables::edgeVertices[face.getEdgeIDs()[(j + 1) % 4]];
+			BOOST_CHECK(a[0] == b[0] || a[0] == b[1] || a[1] == b[0] || a[1] == b[1]);
+			const unsigned char * faces = util::CubeTables::edgeFaces[face.getEdgeIDs()[j]];
+			BOOST_CHECK(faces[0] == i || faces[1] == i);
+		}
+		const unsigned char * first = util::CubeTables::edgeVertices[face.getEdgeIDs()[0]];
+		BOOST_CHECK_EQUAL(int(first[0]), int(face.getVertexIDs()[0]));
+		BOOST_CHECK_EQUAL(int(first[1]), int(face.getVertexIDs()[1]));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(EdgeAccess) {
+	BOOST_CHECK_EQUAL(Cube::Edge().getID(), 0);
+	BOOST_CHECK_THROW(Cube::Edge(Cube::IDType(12)), std::out_of_range);
+	BOOST_CHECK_THROW(Cube::Edge(Cube::Vertex(Cube::IDType(0)), Cube::Vertex(Cube::IDType(3))), std::invalid_argument);
+	for (unsigned int e = 0; e < Cube::Edge::COUNT; ++e) {
+		const Cube::Edge edge = Cube::Edge(Cube::IDType(e));
+		const Cube::Vertex a = edge.getVertex(0);
+		const Cube::Vertex b = edge.getVertex(1);
+		BOOST_CHECK(a.getNeighbor(edge.getAxis()) == b);
+		BOOST_CHECK(Cube::Edge(a, b) == edge);
+		BOOST_CHECK(Cube::Edge(b, a) == edge);
+		BOOST_CHECK_EQUAL(edge.getCenter()[edge.getAxis()], 0);
+		BOOST_CHECK_EQUAL(edge.getCenter().squaredNorm(), 2);
+		for (unsigned int n = 0; n < 2; ++n) {
+			const Cube::IDType * faceEdges = edge.getFace(n).getEdgeIDs();
+			BOOST_CHECK(std::find(faceEdges, faceEdges + 4, e) != faceEdges + 4);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(FaceEdgeAccess) {
+	for (unsigned int i = 0; i < CUBE_FACE_COUNT; ++i) {
+		const Cube::Face face = Cube::Face(Cube::IDType(i));
+		for (unsigned int j = 0; j < Cube::FaceEdge::COUNT; ++j) {
+			const Cube::FaceEdge fe = Cube::FaceEdge(face, j);
+			const Cube::Edge edge = fe;
+			BOOST_CHECK_EQUAL(edge.getID(), face.getEdgeIDs()[j]);
+
+			/// Its face vertices are the ends of the cube edge
+			const Cube::Edge fromVertices(fe.getFaceVertex(0).getCubeVertex(), fe.getFaceVertex(1).getCubeVertex());
+			BOOST_CHECK(fromVertices == edge);
+
+			/// Neighbors around the face share a face vertex
+			BOOST_CHECK_EQUAL(fe.getFaceVertex(1).getID(), fe.getNeighbor(1).getFaceVertex(0).getID());
+			BOOST_CHECK_EQUAL(fe.getFaceVertex(0).getID(), fe.getNeighbor(0).getFaceVertex(1).getID());
+			BOOST_CHECK(fe.getNeighbor(1).getNeighbor(0) == fe);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PackedLayout) {
+	BOOST_CHECK_EQUAL(sizeof(Cube::PackedVertex), 1);
+	BOOST_CHECK_EQUAL(sizeof(Cube::PackedFace), 1);
+	BOOST_CHECK_EQUAL(sizeof(Cube::PackedFaceVertex), 1);
+	BOOST_CHECK_EQUAL(sizeof(Cube::PackedEdge), 1);
+	BOOST_CHECK_EQUAL(sizeof(Cube::PackedFaceEdge), 1);
+	BOOST_CHECK(boost::has_trivial_copy<Cube::PackedVertex>::value);
+	BOOST_CHECK(boost::has_trivial_destructor<Cube::PackedVertex>::value);
+	BOOST_CHECK(!boost::is_polymorphic<Cube::PackedVertex>::value);
+	BOOST_CHECK(!boost::is_polymorphic<Cube::PackedFaceVertex>::value);
+
+	/// Arrays are just the IDs
+	Cube::PackedVertex verts[CUBE_CORNER_COUNT];
+	for (unsigned int v = 0; v < CUBE_CORNER_COUNT; ++v) {
+		verts[v] = Cube::Vertex(Cube::IDType(v)).pack();
+	}
+	const unsigned char * bytes = reinterpret_cast<const unsigned char *>(verts);
+	for (unsigned int v = 0; v < CUBE_CORNER_COUNT; ++v) {
+		BOOST_CHECK_EQUAL(int(bytes[v]), v);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PackedRoundTrip) {
+	for (unsigned int v = 0; v < CUBE_CORNER_COUNT; ++v) {
+		const Cube::Vertex vert = Cube::Vertex(Cube::IDType(v));
+		const Cube::PackedVertex packed = vert.pack();
+		BOOST_CHECK(Cube::Vertex(packed) == vert);
+		for (unsigned int m = 0; m < 3; ++m) {
+			BOOST_CHECK_EQUAL(packed.getBit(m), vert.getBitset()[m]);
+			BOOST_CHECK(Cube::Vertex(packed.getNeighbor(m)) == vert.getNeighbor(m));
+		}
+	}
+	for (unsigned int i = 0; i < CUBE_FACE_COUNT; ++i) {
+		const Cube::Face face = Cube::Face(Cube::IDType(i));
+		const Cube::PackedFace packed = face.pack();
+		BOOST_CHECK(Cube::Face(packed) == face);
+		BOOST_CHECK_EQUAL(packed.getFixedBitIndex(), face.getFixedBitIndex());
+		BOOST_CHECK_EQUAL(packed.getFixedBitValue(), face.getFixedBitValue());
+		for (unsigned int k = 0; k < 4; ++k) {
+			const Cube::FaceVertex fv = face.getFaceVertex(k);
+			const Cube::PackedFaceVertex packedFV = fv.pack();
+			BOOST_CHECK_EQUAL(Cube::FaceVertex(packedFV).getID(), k);
+			BOOST_CHECK(Cube::FaceVertex(packedFV).getFace() == face);
+			BOOST_CHECK(Cube::Vertex(packedFV.getCubeVertex()) == fv.getCubeVertex());
+
+			const Cube::FaceEdge fe = Cube::FaceEdge(face, k);
+			const Cube::PackedFaceEdge packedFE = fe.pack();
+			BOOST_CHECK(Cube::FaceEdge(packedFE) == fe);
+			BOOST_CHECK(Cube::Edge(packedFE.getCubeEdge()) == fe.getCubeEdge());
+		}
+	}
+	for (unsigned int e = 0; e < Cube::Edge::COUNT; ++e) {
+		const Cube::Edge edge = Cube::Edge(Cube::IDType(e));
+		const Cube::PackedEdge packed = edge.pack();
+		BOOST_CHECK(Cube::Edge(packed) == edge);
+		BOOST_CHECK_EQUAL(packed.getAxis(), edge.getAxis());
+		BOOST_CHECK(Cube::Vertex(packed.getVertex(1)) == edge.getVertex(1));
+	}
+	BOOST_CHECK_THROW(Cube::PackedVertex(8), std::out_of_range);
+	BOOST_CHECK_THROW(Cube::PackedFace(6), std::out_of_range);
+	BOOST_CHECK_THROW(Cube::PackedEdge(12), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(PackedStreaming) {
+	const Cube::Face face = Cube::Face(Cube::IDType(4));
+	const Cube::FaceVertex fv = face.getFaceVertex(3);
+	const Cube::FaceEdge fe = Cube::FaceEdge(face, 2);
+	const Cube::Vertex vert = fv.getCubeVertex();
+	const Cube::Edge edge = fe.getCubeEdge();
+
+	std::ostringstream full, packed;
+	full << vert << ", " << face << ", " << fv << ", " << edge << ", " << fe;
+	packed << vert.pack() << ", " << face.pack() << ", " << fv.pack() << ", " << edge.pack() << ", " << fe.pack();
+	BOOST_CHECK_EQUAL(full.str(), packed.str());
+	BOOST_CHECK_EQUAL(packed.str(), "Vertex 7, Face 4, Face vertex 3 on face 4, Edge 3, Face edge 2 on face 4");
+}
@@ -0,0 +1,194 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE EigenBinaryIO
+
+// Internal Includes
+#include <util/EigenBinaryIO.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+// Standard includes
+#include <vector>
+#include <cstdio>
+
+using namespace boost::unit_test;
+using namespace util;
+
+typedef std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > Matrix4dVector;
+
+BOOST_AUTO_TEST_CASE(FixedRoundTrip) {
+	const Eigen::Matrix4d m(Eigen::Matrix4d::Random());
+	std::vector<unsigned char> bytes(binarySize(m));
+	BOOST_CHECK_EQUAL(bytes.size(), 16 * sizeof(double));
+	BOOST_CHECK_EQUAL(writeBinary(&bytes[0], m), bytes.size());
+
+	Eigen::Matrix4d deserialized;
+	BOOST_CHECK_EQUAL(readBinary(&bytes[0], bytes.size(), deserialized), bytes.size());
+	BOOST_CHECK_EQUAL(m, deserialized);
+}
+
+BOOST_AUTO_TEST_CASE(DynamicRoundTrip) {
+	const Eigen::MatrixXf m(Eigen::MatrixXf::Random(3, 7));
+	std::vector<unsigned char> bytes(binarySize(m));
+	BOOST_CHECK_EQUAL(bytes.size(), 2 * 8 + 21 * sizeof(float));
+	writeBinary(&bytes[0], m);
+
+	Eigen::MatrixXf deserialized;
+	BOOST_CHECK_EQUAL(readBinary(&bytes[0], bytes.size(), deserialized), bytes.size());
+	BOOST_CHECK_EQUAL(deserialized.rows(), 3);
+	BOOST_CHECK_EQUAL(deserialized.cols(), 7);
+	BOOST_CHECK_EQUAL(m, deserialized);
+}
+
+BOOST_AUTO_TEST_CASE(DynamicVectorAndArray) {
+	const Eigen::VectorXi v(Eigen::VectorXi::LinSpaced(5, 1, 5));
+	const Eigen::Array<double, 2, Eigen::Dynamic> a(Eigen::Array<double, 2, Eigen::Dynamic>::Constant(2, 3, 1.5));
+	/// Only the dynamic dimension is stored
+	BOOST_CHECK_EQUAL(binarySize(v), 8 + 5 * sizeof(int));
+	BOOST_CHECK_EQUAL(binarySize(a), 8 + 6 * sizeof(double));
+
+	std::vector<unsigned char> bytes(binarySize(v) + binarySize(a));
+	const std::size_t first = writeBinary(&bytes[0], v);
+	writeBinary(&bytes[first], a);
+
+	Eigen::VectorXi v2;
+	Eigen::Array<double, 2, Eigen::Dynamic> a2;
+	const std::size_t consumed = readBinary(&bytes[0], bytes.size(), v2);
+	readBinary(&bytes[consumed], bytes.size() - consumed, a2);
+	BOOST_CHECK_EQUAL(v, v2);
+	BOOST_CHECK((a == a2).all());
+}
+
+BOOST_AUTO_TEST_CASE(LittleEndianLayout) {
+	Eigen::VectorXd v(1);
+	v[0] = 1.0;
+	std::vector<unsigned char> bytes(binarySize(v));
+	writeBinary(&bytes[0], v);
+	/// Dimension 1 as a little-endian 64-bit integer, then 1.0 as a double
+	const unsigned char expected[] = {1, 0, 0, 0, 0, 0, 0, 0,
+	                                  0, 0, 0, 0, 0, 0, 0xf0, 0x3f
+	                                 };
+	BOOST_CHECK_EQUAL_COLLECTIONS(bytes.begin(), bytes.end(), expected, expected + sizeof(expected));
+}
+
+BOOST_AUTO_TEST_CASE(IncompleteInput) {
+	const Eigen::MatrixXd m(Eigen::MatrixXd::Random(2, 2));
+	std::vector<unsigned char> bytes(binarySize(m));
+	writeBinary(&bytes[0], m);
+	Eigen::MatrixXd deserialized;
+	BOOST_CHECK_EQUAL(readBinary(&bytes[0], 4, deserialized), 0);
+	BOOST_CHECK_EQUAL(readBinary(&bytes[0], bytes.size() - 1, deserialized), 0);
+}
+
+BOOST_AUTO_TEST_CASE(BulkArrayRoundTrip) {
+	Matrix4dVector ms;
+	for (int i = 0; i < 10; ++i) {
+		ms.push_back(Eigen::Matrix4d::Constant(i));
+	}
+	std::vector<unsigned char> bytes(ms.size() * sizeof(Eigen::Matrix4d));
+	BOOST_CHECK_EQUAL(writeBinaryArray(&bytes[0], &ms[0], ms.size()), bytes.size());
+
+	Matrix4dVector out(ms.size());
+	BOOST_CHECK_EQUAL(readBinaryArray(&bytes[0], &out[0], out.size()), bytes.size());
+	for (std::size_t i = 0; i < ms.size(); ++i) {
+		BOOST_CHECK_EQUAL(ms[i], out[i]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveBufferStreaming) {
+	ReceiveBuffer<1024> buf;
+	const Eigen::Matrix4d a(Eigen::Matrix4d::Identity());
+	const Eigen::VectorXd b(Eigen::VectorXd::Constant(3, 2.0));
+	appendBinary(buf, a);
+	appendBinary(buf, b);
+
+	/// Simulate a partial receive of the second matrix
+	ReceiveBuffer<1024> partial(buf.begin(), buf.end() - 1);
+
+	Eigen::Matrix4d a2;
+	Eigen::VectorXd b2;
+	BOOST_CHECK(consumeBinary(partial, a2));
+	BOOST_CHECK_EQUAL(a, a2);
+	BOOST_CHECK(!consumeBinary(partial, b2));
+	partial.push_back(buf[buf.size() - 1]);
+	BOOST_CHECK(consumeBinary(partial, b2));
+	BOOST_CHECK_EQUAL(b, b2);
+	BOOST_CHECK(partial.empty());
+}
+
+BOOST_AUTO_TEST_CASE(FileDescriptorRoundTrip) {
+	std::FILE * f = std::tmpfile();
+	BOOST_REQUIRE(f);
+	const int fd = fileno(f);
+
+	const Eigen::Matrix4d a(Eigen::Matrix4d::Random());
+	const Eigen::MatrixXd b(Eigen::MatrixXd::Random(5, 2));
+	Matrix4dVector ms(3, Eigen::Matrix4d::Constant(7));
+	writeBinaryFD(fd, a);
+	writeBinaryFD(fd, b);
+	writeBinaryArrayFD(fd, &ms[0], ms.size());
+	BOOST_REQUIRE_EQUAL(lseek(fd, 0, SEEK_SET), 0);
+
+	Eigen::Matrix4d a2;
+	Eigen::MatrixXd b2;
+	Matrix4dVector ms2(3);
+	BOOST_CHECK(readBinaryFD(fd, a2));
+	BOOST_CHECK(readBinaryFD(fd, b2));
+	BOOST_CHECK(readBinaryArrayFD(fd, &ms2[0], ms2.size()));
+	BOOST_CHECK_EQUAL(a, a2);
+	BOOST_CHECK_EQUAL(b, b2);
+	BOOST_CHECK_EQUAL(ms2[2], ms[2]);
+
+	/// Clean end of file
+	BOOST_CHECK(!readBinaryFD(fd, a2));
+	std::fclose(f);
+}
+
+BOOST_AUTO_TEST_CASE(FileDescriptorTruncated) {
+	std::FILE * f = std::tmpfile();
+	BOOST_REQUIRE(f);
+	const int fd = fileno(f);
+	const Eigen::MatrixXd b(Eigen::MatrixXd::Random(5, 2));
+	std::vector<unsigned char> bytes(binarySize(b));
+	writeBinary(&bytes[0], b);
+	BOOST_REQUIRE_EQUAL(write(fd, &bytes[0], bytes.size() - 3), static_cast<ssize_t>(bytes.size() - 3));
+	BOOST_REQUIRE_EQUAL(lseek(fd, 0, SEEK_SET), 0);
+
+	Eigen::MatrixXd b2;
+	BOOST_CHECK_THROW(readBinaryFD(fd, b2), std::runtime_error);
+	std::fclose(f);
+}
+
+BOOST_AUTO_TEST_CASE(MalformedHeader) {
+	/// 2^61 + 1 doubles: the byte count wraps to 8 in 64 bits
+	const stdint::uint64_t wrapping[3] = {(stdint::uint64_t(1) << 61) + 1, 1, 0};
+	const stdint::uint64_t negative[3] = {stdint::uint64_t(1) << 63, 1, 0};
+	const stdint::uint64_t product[3] = {stdint::uint64_t(1) << 32, stdint::uint64_t(1) << 32, 0};
+	const stdint::uint64_t * headers[] = {wrapping, negative, product};
+	for (int i = 0; i < 3; ++i) {
+		unsigned char bytes[24];
+		detail::binaryCopyLittleEndian(bytes, headers[i], 3, sizeof(stdint::uint64_t));
+		Eigen::MatrixXd m(2, 2);
+		BOOST_CHECK_THROW(readBinary(bytes, sizeof(bytes), m), std::runtime_error);
+		BOOST_CHECK_EQUAL(m.size(), 4);
+
+		std::FILE * f = std::tmpfile();
+		BOOST_REQUIRE(f);
+		const int fd = fileno(f);
+		BOOST_REQUIRE_EQUAL(write(fd, bytes, sizeof(bytes)), static_cast<ssize_t>(sizeof(bytes)));
+		BOOST_REQUIRE_EQUAL(lseek(fd, 0, SEEK_SET), 0);
+		BOOST_CHECK_THROW(readBinaryFD(fd, m), std::runtime_error);
+		BOOST_CHECK_EQUAL(m.size(), 4);
+		std::fclose(f);
+	}
+}
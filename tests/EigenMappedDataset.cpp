@@ -0,0 +1,176 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE EigenMappedDataset
+
+// Internal Includes
+#include <util/EigenMappedDataset.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+// Standard includes
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <fstream>
+#include <cstddef>
+#include <stdexcept>
+
+using namespace boost::unit_test;
+using namespace util;
+
+typedef std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > Matrix4dVector;
+
+namespace {
+	Matrix4dVector makeMatrices(std::size_t n) {
+		Matrix4dVector ms;
+		for (std::size_t i = 0; i < n; ++i) {
+			Eigen::Matrix4d m(Eigen::Matrix4d::Identity());
+			m.block<3, 1>(0, 3) = Eigen::Vector3d(double(i), -0.5 * i, 1.0 / (i + 1));
+			ms.push_back(m);
+		}
+		return ms;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(EmptyRoundTrip) {
+	{
+		MatrixDatasetWriter<Eigen::Matrix4d> writer("dataset_empty.bin");
+	}
+	MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_empty.bin");
+	BOOST_CHECK_EQUAL(dataset.size(), 0);
+	BOOST_CHECK(dataset.empty());
+	BOOST_CHECK(dataset.prefetch(0, 10));
+	std::remove("dataset_empty.bin");
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalRoundTrip) {
+	const Matrix4dVector ms(makeMatrices(1000));
+	{
+		MatrixDatasetWriter<Eigen::Matrix4d> writer("dataset_incremental.bin");
+		for (std::size_t i = 0; i < ms.size(); ++i) {
+			writer.append(ms[i]);
+		}
+		BOOST_CHECK_EQUAL(writer.size(), ms.size());
+	}
+	MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_incremental.bin");
+	BOOST_REQUIRE_EQUAL(dataset.size(), ms.size());
+	for (std::size_t i = 0; i < ms.size(); ++i) {
+		BOOST_CHECK_EQUAL(dataset[i], ms[i]);
+	}
+	/// Views point into the mapping: no copy
+	BOOST_CHECK_EQUAL(dataset[1].data(), dataset.data()[1].data());
+	std::remove("dataset_incremental.bin");
+}
+
+BOOST_AUTO_TEST_CASE(BulkRoundTrip) {
+	const Matrix4dVector ms(makeMatrices(257));
+	saveMatrixDataset("dataset_bulk.bin", &ms[0], ms.size());
+	MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_bulk.bin", DatasetRandomAccess);
+	BOOST_REQUIRE_EQUAL(dataset.size(), ms.size());
+	BOOST_CHECK_EQUAL(dataset[256], ms[256]);
+	BOOST_CHECK_EQUAL(dataset.get(13), ms[13]);
+	const Eigen::Vector4d translated = dataset[42] * Eigen::Vector4d(0, 0, 0, 1);
+	BOOST_CHECK_EQUAL(translated, ms[42].col(3));
+	std::remove("dataset_bulk.bin");
+}
+
+BOOST_AUTO_TEST_CASE(AlignedPayload) {
+	const Matrix4dVector ms(makeMatrices(3));
+	saveMatrixDataset("dataset_aligned.bin", &ms[0], ms.size());
+	MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_aligned.bin");
+	BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(dataset.data()) % 64, 0);
+	std::remove("dataset_aligned.bin");
+}
+
+BOOST_AUTO_TEST_CASE(AccessHints) {
+	const Matrix4dVector ms(makeMatrices(5000));
+	saveMatrixDataset("dataset_hints.bin", &ms[0], ms.size());
+	MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_hints.bin");
+	BOOST_CHECK(dataset.advise(DatasetSequentialAccess));
+	BOOST_CHECK(dataset.advise(DatasetRandomAccess));
+	BOOST_CHECK(dataset.advise(DatasetNormalAccess));
+	BOOST_CHECK(dataset.prefetch(0, 100));
+	BOOST_CHECK(dataset.prefetch(4990, 100));
+	BOOST_CHECK(dataset.prefetch(6000, 100));
+	BOOST_CHECK_EQUAL(dataset[4999], ms[4999]);
+	std::remove("dataset_hints.bin");
+}
+
+BOOST_AUTO_TEST_CASE(CheckedAccess) {
+	const Matrix4dVector ms(makeMatrices(2));
+	saveMatrixDataset("dataset_checked.bin", &ms[0], ms.size());
+	MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_checked.bin");
+	BOOST_CHECK_NO_THROW(dataset.get(1));
+	BOOST_CHECK_THROW(dataset.get(2), std::out_of_range);
+	std::remove("dataset_checked.bin");
+}
+
+BOOST_AUTO_TEST_CASE(RejectsMismatchedType) {
+	const Eigen::Matrix4f m(Eigen::Matrix4f::Identity());
+	saveMatrixDataset("dataset_float.bin", &m, 1);
+	BOOST_CHECK_THROW(MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_float.bin"), std::runtime_error);
+	BOOST_CHECK_THROW(MappedMatrixDataset<Eigen::Matrix4i> dataset("dataset_float.bin"), std::runtime_error);
+	typedef Eigen::Matrix<float, 4, 4, Eigen::RowMajor> Matrix4fRowMajor;
+	BOOST_CHECK_THROW(MappedMatrixDataset<Matrix4fRowMajor> dataset("dataset_float.bin"), std::runtime_error);
+	BOOST_CHECK_NO_THROW(MappedMatrixDataset<Eigen::Matrix4f> dataset("dataset_float.bin"));
+	std::remove("dataset_float.bin");
+}
+
+BOOST_AUTO_TEST_CASE(RejectsTruncated) {
+	const Matrix4dVector ms(makeMatrices(4));
+	saveMatrixDataset("dataset_truncated.bin", &ms[0], ms.size());
+	{
+		std::ifstream in("dataset_truncated.bin", std::ios::binary);
+		std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		in.close();
+		std::ofstream out("dataset_truncated.bin", std::ios::binary | std::ios::trunc);
+		out.write(&bytes[0], bytes.size() - 8);
+	}
+	BOOST_CHECK_THROW(MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_truncated.bin"), std::runtime_error);
+	std::remove("dataset_truncated.bin");
+}
+
+BOOST_AUTO_TEST_CASE(RejectsMissingFile) {
+	BOOST_CHECK_THROW(MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_does_not_exist.bin"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(RejectsWrappingHeader) {
+	const Matrix4dVector ms(makeMatrices(4));
+	/// count * matrixBytes + payloadStart wraps to the real file size
+	const stdint::uint64_t count = (~stdint::uint64_t(0) / sizeof(Eigen::Matrix4d)) + 1;
+	saveMatrixDataset("dataset_wrapping.bin", &ms[0], ms.size());
+	{
+		std::fstream f("dataset_wrapping.bin", std::ios::in | std::ios::out | std::ios::binary);
+		f.seekp(offsetof(detail::MatrixDatasetHeader, count));
+		f.write(reinterpret_cast<const char *>(&count), sizeof(count));
+	}
+	BOOST_CHECK_THROW(MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_wrapping.bin"), std::runtime_error);
+
+	const stdint::uint64_t payloadStart = stdint::uint64_t(0) - 64;
+	saveMatrixDataset("dataset_wrapping.bin", &ms[0], ms.size());
+	{
+		std::fstream f("dataset_wrapping.bin", std::ios::in | std::ios::out | std::ios::binary);
+		f.seekp(offsetof(detail::MatrixDatasetHeader, payloadStart));
+		f.write(reinterpret_cast<const char *>(&payloadStart), sizeof(payloadStart));
+	}
+	BOOST_CHECK_THROW(MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_wrapping.bin"), std::runtime_error);
+	std::remove("dataset_wrapping.bin");
+}
+
+BOOST_AUTO_TEST_CASE(RejectsEmptyFile) {
+	{
+		std::ofstream out("dataset_empty_file.bin", std::ios::binary | std::ios::trunc);
+	}
+	BOOST_CHECK_THROW(MappedMatrixDataset<Eigen::Matrix4d> dataset("dataset_empty_file.bin"), std::runtime_error);
+	std::remove("dataset_empty_file.bin");
+}
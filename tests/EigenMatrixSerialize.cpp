@@ -15,13 +15,96 @@
 #include <BoostTestTargetConfig.h>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#define EIGEN_YES_I_KNOW_SPARSE_MODULE_IS_NOT_STABLE_YET
+#include <Eigen/Sparse>
 
 // Standard includes
 #include <string>
+#include <vector>
 #include <sstream>
+#include <stdexcept>
 
 using namespace boost::unit_test;
 
+namespace {
+	template<typename OArchive, typename IArchive, typename T, typename U>
+	void roundTrip(T const& in, U & out) {
+		std::stringstream ss;
+		{
+			OArchive outArchive(ss);
+			outArchive << in;
+		}
+		{
+			IArchive inArchive(ss);
+			inArchive >> out;
+		}
+	}
+
+	template<typename T, typename U>
+	void textRoundTrip(T const& in, U & out) {
+		roundTrip<boost::archive::text_oarchive, boost::archive::text_iarchive>(in, out);
+	}
+
+	template<typename T, typename U>
+	void binaryRoundTrip(T const& in, U & out) {
+		roundTrip<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(in, out);
+	}
+
+	template<typename SparseType>
+	SparseType makeSparse() {
+		Eigen::MatrixXd dense(Eigen::MatrixXd::Zero(5, 7));
+		dense(0, 0) = 1;
+		dense(0, 6) = 2;
+		dense(2, 3) = -3;
+		dense(4, 1) = 4.5;
+		dense(4, 6) = 5;
+		return SparseType(dense.sparseView());
+	}
+
+	/// Writes the fields of a 5 x 7 column-major sparse matrix directly,
+	/// so that they can be inconsistent.
+	std::string sparseArchive(std::vector<int> const& outer, std::vector<int> const& inner) {
+		std::stringstream ss;
+		{
+			boost::archive::text_oarchive ar(ss);
+			const int rows = 5, cols = 7, nonZeros = int(inner.size());
+			const std::vector<double> values(inner.size(), 1.0);
+			ar << rows << cols << nonZeros;
+			ar << boost::serialization::make_array(&outer[0], outer.size());
+			if (nonZeros > 0) {
+				ar << boost::serialization::make_array(&inner[0], inner.size());
+				ar << boost::serialization::make_array(&values[0], values.size());
+			}
+		}
+		return ss.str();
+	}
+
+	/// Loads a sparseArchive(), returning whether it was accepted. Calls
+	/// load() directly since the fields were written without a class header.
+	bool loadSparseArchive(std::string const& archive, Eigen::SparseMatrix<double> & m) {
+		std::stringstream ss(archive);
+		boost::archive::text_iarchive ar(ss);
+		try {
+			boost::serialization::load(ar, m, 0);
+		} catch (std::runtime_error &) {
+			return false;
+		}
+		return true;
+	}
+
+	std::vector<int> indices(int a, int b, int c, int d, int e, int f, int g, int h) {
+		const int values[] = {a, b, c, d, e, f, g, h};
+		return std::vector<int>(values, values + 8);
+	}
+
+	std::vector<int> indices(int a, int b) {
+		const int values[] = {a, b};
+		return std::vector<int>(values, values + 2);
+	}
+}
+
 
 BOOST_AUTO_TEST_CASE(IdentityRoundTrip) {
 
@@ -59,3 +142,135 @@ BOOST_AUTO_TEST_CASE(ConstantVecRoundTrip) {
 	}
 	BOOST_CHECK_EQUAL(Eigen::Vector3d::Constant(1), deserialized);
 }
+
+BOOST_AUTO_TEST_CASE(DynamicMatrixRoundTrip) {
+	const Eigen::MatrixXd m(Eigen::MatrixXd::Random(3, 5));
+	Eigen::MatrixXd fromText;
+	textRoundTrip(m, fromText);
+	BOOST_CHECK_EQUAL(fromText.rows(), 3);
+	BOOST_CHECK_EQUAL(fromText.cols(), 5);
+	BOOST_CHECK(m.isApprox(fromText));
+
+	Eigen::MatrixXd fromBinary(Eigen::MatrixXd::Zero(10, 10));
+	binaryRoundTrip(m, fromBinary);
+	BOOST_CHECK_EQUAL(m, fromBinary);
+
+	const Eigen::VectorXf v(Eigen::VectorXf::LinSpaced(9, 0, 8));
+	Eigen::VectorXf v2;
+	binaryRoundTrip(v, v2);
+	BOOST_CHECK_EQUAL(v, v2);
+
+	const Eigen::MatrixXd empty;
+	Eigen::MatrixXd empty2(Eigen::MatrixXd::Ones(2, 2));
+	binaryRoundTrip(empty, empty2);
+	BOOST_CHECK_EQUAL(empty2.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PartiallyDynamicRoundTrip) {
+	typedef Eigen::Matrix<double, 3, Eigen::Dynamic, Eigen::RowMajor> Matrix3Xr;
+	const Matrix3Xr m(Matrix3Xr::Random(3, 4));
+	Matrix3Xr m2;
+	binaryRoundTrip(m, m2);
+	BOOST_CHECK_EQUAL(m2.cols(), 4);
+	BOOST_CHECK_EQUAL(m, m2);
+}
+
+BOOST_AUTO_TEST_CASE(ArrayRoundTrip) {
+	const Eigen::ArrayXXf a(Eigen::ArrayXXf::Random(4, 2));
+	Eigen::ArrayXXf a2;
+	binaryRoundTrip(a, a2);
+	BOOST_CHECK((a == a2).all());
+
+	const Eigen::Array3i fixed(1, 2, 3);
+	Eigen::Array3i fixed2;
+	textRoundTrip(fixed, fixed2);
+	BOOST_CHECK((fixed == fixed2).all());
+}
+
+BOOST_AUTO_TEST_CASE(MapRoundTrip) {
+	double raw[6] = {1, 2, 3, 4, 5, 6};
+	const Eigen::Map<const Eigen::MatrixXd> view(raw, 2, 3);
+
+	/// A map is written exactly like its plain type
+	Eigen::MatrixXd plain;
+	textRoundTrip(view, plain);
+	BOOST_CHECK_EQUAL(plain, view);
+
+	double target[6] = {0, 0, 0, 0, 0, 0};
+	Eigen::Map<Eigen::MatrixXd> targetView(target, 2, 3);
+	binaryRoundTrip(plain, targetView);
+	BOOST_CHECK_EQUAL_COLLECTIONS(target, target + 6, raw, raw + 6);
+}
+
+BOOST_AUTO_TEST_CASE(StridedMapRoundTrip) {
+	Eigen::Matrix4d big(Eigen::Matrix4d::Random());
+	const Eigen::Map<const Eigen::Matrix2d, Eigen::Unaligned, Eigen::OuterStride<4> > block(big.data() + 5);
+	Eigen::Matrix2d plain;
+	binaryRoundTrip(block, plain);
+	BOOST_CHECK_EQUAL(plain, (big.block<2, 2>(1, 1)));
+
+	/// Every other element: not contiguous even within an inner vector
+	double target[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+	Eigen::Map<Eigen::Vector4d, Eigen::Unaligned, Eigen::InnerStride<2> > everyOther(target);
+	const Eigen::Vector4d v(1, 2, 3, 4);
+	textRoundTrip(v, everyOther);
+	BOOST_CHECK_EQUAL(target[0], 1);
+	BOOST_CHECK_EQUAL(target[1], 0);
+	BOOST_CHECK_EQUAL(target[6], 4);
+}
+
+BOOST_AUTO_TEST_CASE(MapDimensionMismatch) {
+	const Eigen::VectorXd v(Eigen::VectorXd::Ones(5));
+	double target[4];
+	Eigen::Map<Eigen::VectorXd> view(target, 4);
+	BOOST_CHECK_THROW(binaryRoundTrip(v, view), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(SparseRoundTrip) {
+	typedef Eigen::SparseMatrix<double> CSC;
+	typedef Eigen::SparseMatrix<double, Eigen::RowMajor> CSR;
+	const CSC csc(makeSparse<CSC>());
+	const CSR csr(makeSparse<CSR>());
+	BOOST_REQUIRE_EQUAL(csr.nonZeros(), 5);
+
+	CSR csr2;
+	binaryRoundTrip(csr, csr2);
+	BOOST_CHECK_EQUAL(csr2.rows(), 5);
+	BOOST_CHECK_EQUAL(csr2.cols(), 7);
+	BOOST_CHECK_EQUAL(csr2.nonZeros(), 5);
+	BOOST_CHECK_EQUAL(Eigen::MatrixXd(csr2), Eigen::MatrixXd(csr));
+
+	CSC csc2(makeSparse<CSC>() * 2);
+	textRoundTrip(csc, csc2);
+	BOOST_CHECK_EQUAL(csc2.nonZeros(), 5);
+	BOOST_CHECK_EQUAL(Eigen::MatrixXd(csc2), Eigen::MatrixXd(csc));
+}
+
+BOOST_AUTO_TEST_CASE(EmptySparseRoundTrip) {
+	const Eigen::SparseMatrix<float> empty(3, 4);
+	Eigen::SparseMatrix<float> empty2(makeSparse<Eigen::SparseMatrix<double> >().cast<float>());
+	binaryRoundTrip(empty, empty2);
+	BOOST_CHECK_EQUAL(empty2.rows(), 3);
+	BOOST_CHECK_EQUAL(empty2.cols(), 4);
+	BOOST_CHECK_EQUAL(empty2.nonZeros(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MalformedSparse) {
+	Eigen::SparseMatrix<double> m;
+	BOOST_REQUIRE(loadSparseArchive(sparseArchive(indices(0, 1, 1, 1, 1, 1, 1, 2), indices(0, 4)), m));
+	BOOST_CHECK_EQUAL(m.nonZeros(), 2);
+	BOOST_CHECK_EQUAL(m.coeff(4, 6), 1);
+
+	/// Outer offsets that decrease, or do not start at 0
+	BOOST_CHECK(!loadSparseArchive(sparseArchive(indices(0, 2, 1, 1, 1, 1, 1, 2), indices(0, 1)), m));
+	BOOST_CHECK(!loadSparseArchive(sparseArchive(indices(1, 1, 1, 1, 1, 1, 1, 2), indices(0, 1)), m));
+	/// Inner indices out of range
+	BOOST_CHECK(!loadSparseArchive(sparseArchive(indices(0, 1, 1, 1, 1, 1, 1, 2), indices(0, 5)), m));
+	BOOST_CHECK(!loadSparseArchive(sparseArchive(indices(0, 2, 2, 2, 2, 2, 2, 2), indices(-1, 0)), m));
+	/// Inner indices unsorted, or repeated, within an outer vector
+	BOOST_CHECK(!loadSparseArchive(sparseArchive(indices(0, 2, 2, 2, 2, 2, 2, 2), indices(3, 1)), m));
+	BOOST_CHECK(!loadSparseArchive(sparseArchive(indices(0, 2, 2, 2, 2, 2, 2, 2), indices(1, 1)), m));
+	/// A rejected load leaves a valid, empty matrix
+	BOOST_CHECK_EQUAL(m.nonZeros(), 0);
+	BOOST_CHECK_EQUAL(m.rows(), 5);
+}
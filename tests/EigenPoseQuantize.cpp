@@ -0,0 +1,217 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE EigenPoseQuantize
+
+// Internal Includes
+#include <util/EigenPoseQuantize.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <Eigen/StdVector>
+
+// Standard includes
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace boost::unit_test;
+using namespace util;
+
+typedef std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > Matrix4dVector;
+
+namespace {
+	Eigen::Matrix4d makePose(Eigen::Vector3d const& position, Eigen::Quaterniond const& rotation) {
+		Eigen::Matrix4d pose(Eigen::Matrix4d::Identity());
+		pose.topLeftCorner<3, 3>() = rotation.toRotationMatrix();
+		pose.block<3, 1>(0, 3) = position;
+		return pose;
+	}
+
+	/// A head-tracked object wandering around at walking speed, sampled at 60Hz
+	Matrix4dVector makeTrajectory(std::size_t n) {
+		Matrix4dVector poses;
+		for (std::size_t i = 0; i < n; ++i) {
+			const double t = i / 60.0;
+			const Eigen::Vector3d position(1.5 * std::sin(0.7 * t), 1.7 + 0.05 * std::sin(3.1 * t), 1.2 * std::cos(0.5 * t));
+			const Eigen::Quaterniond rotation(Eigen::AngleAxisd(0.9 * t, Eigen::Vector3d::UnitY())
+			                                  * Eigen::AngleAxisd(0.2 * std::sin(1.3 * t), Eigen::Vector3d::UnitX()));
+			poses.push_back(makePose(position, rotation));
+		}
+		return poses;
+	}
+
+	double rotationError(Eigen::Quaterniond const& a, Eigen::Quaterniond const& b) {
+		return a.angularDistance(b);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(QuantizationPrecision) {
+	const PoseQuantizer quantizer(0.001, 12);
+	for (int i = 0; i < 1000; ++i) {
+		const Eigen::Vector3d position(Eigen::Vector3d::Random() * 100);
+		const Eigen::Quaterniond rotation(Eigen::Vector4d::Random().normalized());
+		Eigen::Vector3d position2;
+		Eigen::Quaterniond rotation2;
+		quantizer.dequantize(quantizer.quantize(position, rotation), position2, rotation2);
+		BOOST_CHECK_LE((position - position2).cwiseAbs().maxCoeff(), 0.0005 + 1e-12);
+		/// Each component within 2^-12 / sqrt(2), three of them
+		BOOST_CHECK_LT(rotationError(rotation, rotation2), 2 * std::sqrt(3.0) * std::ldexp(1.0, -12));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(MatrixRoundTrip) {
+	const PoseQuantizer quantizer;
+	const Matrix4dVector poses(makeTrajectory(100));
+	for (std::size_t i = 0; i < poses.size(); ++i) {
+		const Eigen::Matrix4d decoded = quantizer.dequantize(quantizer.quantize(poses[i]));
+		BOOST_CHECK((decoded - poses[i]).cwiseAbs().maxCoeff() < 1e-3);
+		BOOST_CHECK_EQUAL(decoded.row(3), Eigen::RowVector4d(0, 0, 0, 1));
+		/// Still a rotation
+		BOOST_CHECK((decoded.topLeftCorner<3, 3>() * decoded.topLeftCorner<3, 3>().transpose()).isIdentity(1e-12));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(MatrixCornerNotRangeChecked) {
+	/// 1 / 1e-10 is beyond the position range, but 0.1 / 1e-10 is not.
+	const PoseQuantizer fine(1e-10);
+	const Eigen::Matrix4d pose(makePose(Eigen::Vector3d(0.1, -0.1, 0.05), Eigen::Quaterniond::Identity()));
+	Eigen::Matrix4d decoded;
+	BOOST_REQUIRE_NO_THROW(decoded = fine.dequantize(fine.quantize(pose)));
+	BOOST_CHECK((decoded - pose).cwiseAbs().maxCoeff() < 1e-9);
+
+	Eigen::Matrix4d scaled(makePose(Eigen::Vector3d(1, 2, 3), Eigen::Quaterniond::Identity()));
+	scaled(3, 3) = 1e12;
+	const PoseQuantizer quantizer;
+	BOOST_CHECK_NO_THROW(quantizer.quantize(scaled));
+}
+
+BOOST_AUTO_TEST_CASE(NegatedQuaternionIsSamePose) {
+	const PoseQuantizer quantizer;
+	const Eigen::Quaterniond q(Eigen::AngleAxisd(2.0, Eigen::Vector3d(1, 2, 3).normalized()));
+	const Eigen::Quaterniond negated(-q.w(), -q.x(), -q.y(), -q.z());
+	BOOST_CHECK(quantizer.quantize(Eigen::Vector3d::Zero(), q) == quantizer.quantize(Eigen::Vector3d::Zero(), negated));
+}
+
+BOOST_AUTO_TEST_CASE(IdentityIsDefault) {
+	const PoseQuantizer quantizer;
+	BOOST_CHECK(quantizer.quantize(Eigen::Matrix4d::Identity()) == QuantizedPose());
+	BOOST_CHECK_EQUAL(quantizer.dequantize(QuantizedPose()), Eigen::Matrix4d::Identity());
+}
+
+BOOST_AUTO_TEST_CASE(SimdMatchesScalar) {
+	const double scales[] = {1.0, 10000.0, 11584.0};
+	for (int s = 0; s < 3; ++s) {
+		for (int i = 0; i < 1000; ++i) {
+			double in[4];
+			for (int j = 0; j < 4; ++j) {
+				/// Include exact ties every so often
+				in[j] = (i % 7 == 0) ? (i - 500 + 0.5 * j) / scales[s] : Eigen::internal::random<double>(-5, 5);
+			}
+			stdint::int32_t simd[4], scalar[4];
+			BOOST_REQUIRE(detail::quantizeLanes(in, scales[s], simd));
+			BOOST_REQUIRE(detail::quantizeLanesScalar(in, scales[s], scalar));
+			BOOST_CHECK_EQUAL_COLLECTIONS(simd, simd + 4, scalar, scalar + 4);
+
+			double simdOut[4], scalarOut[4];
+			detail::dequantizeLanes(simd, 1.0 / scales[s], simdOut);
+			detail::dequantizeLanesScalar(scalar, 1.0 / scales[s], scalarOut);
+			BOOST_CHECK_EQUAL_COLLECTIONS(simdOut, simdOut + 4, scalarOut, scalarOut + 4);
+		}
+	}
+	const double huge[4] = {0, 0, 2e9, 0};
+	stdint::int32_t out[4];
+	BOOST_CHECK(!detail::quantizeLanes(huge, 1.0, out));
+	BOOST_CHECK(!detail::quantizeLanesScalar(huge, 1.0, out));
+	const double nan[4] = {0, std::numeric_limits<double>::quiet_NaN(), 0, 0};
+	BOOST_CHECK(!detail::quantizeLanes(nan, 1.0, out));
+	BOOST_CHECK(!detail::quantizeLanesScalar(nan, 1.0, out));
+}
+
+BOOST_AUTO_TEST_CASE(DeltaRoundTrip) {
+	const PoseQuantizer quantizer;
+	const Matrix4dVector poses(makeTrajectory(600));
+	std::vector<QuantizedPose> quantized(poses.size());
+	quantizer.quantize(&poses[0], &quantized[0], poses.size());
+
+	QuantizedPose sent, received;
+	std::size_t totalBytes = 0;
+	for (std::size_t i = 0; i < quantized.size(); ++i) {
+		unsigned char buf[POSE_DELTA_MAX_BYTES];
+		const std::size_t written = encodePoseDelta(buf, quantized[i], sent);
+		BOOST_CHECK_LE(written, POSE_DELTA_MAX_BYTES);
+		QuantizedPose decoded;
+		BOOST_CHECK_EQUAL(decodePoseDelta(buf, written, received, decoded), written);
+		BOOST_CHECK(decoded == quantized[i]);
+		sent = quantized[i];
+		received = decoded;
+		totalBytes += written;
+	}
+	/// At least a tenth of the 128 bytes of a Matrix4d
+	BOOST_CHECK_LT(double(totalBytes) / poses.size(), 12.8);
+}
+
+BOOST_AUTO_TEST_CASE(LargestComponentChange) {
+	const PoseQuantizer quantizer;
+	const QuantizedPose baseline = quantizer.quantize(Eigen::Vector3d::Zero(), Eigen::Quaterniond::Identity());
+	const QuantizedPose flipped = quantizer.quantize(Eigen::Vector3d(1, 2, 3),
+	                              Eigen::Quaterniond(Eigen::AngleAxisd(3.0, Eigen::Vector3d::UnitZ())));
+	BOOST_REQUIRE(flipped.largest != baseline.largest);
+	unsigned char buf[POSE_DELTA_MAX_BYTES];
+	const std::size_t written = encodePoseDelta(buf, flipped, baseline);
+	QuantizedPose decoded;
+	BOOST_CHECK_EQUAL(decodePoseDelta(buf, written, baseline, decoded), written);
+	BOOST_CHECK(decoded == flipped);
+}
+
+BOOST_AUTO_TEST_CASE(WorstCaseSize) {
+	QuantizedPose extreme;
+	for (int i = 0; i < 3; ++i) {
+		extreme.position[i] = -1073741823;
+		extreme.rotation[i] = 536870911;
+	}
+	extreme.largest = 0;
+	QuantizedPose baseline;
+	for (int i = 0; i < 3; ++i) {
+		baseline.position[i] = 1073741823;
+	}
+	unsigned char buf[POSE_DELTA_MAX_BYTES];
+	const std::size_t written = encodePoseDelta(buf, extreme, baseline);
+	BOOST_CHECK_LE(written, POSE_DELTA_MAX_BYTES);
+	QuantizedPose decoded;
+	BOOST_CHECK_EQUAL(decodePoseDelta(buf, written, baseline, decoded), written);
+	BOOST_CHECK(decoded == extreme);
+}
+
+BOOST_AUTO_TEST_CASE(IncompleteAndMalformedInput) {
+	const PoseQuantizer quantizer;
+	const QuantizedPose pose = quantizer.quantize(Eigen::Vector3d(10, -20, 30), Eigen::Quaterniond::Identity());
+	unsigned char buf[POSE_DELTA_MAX_BYTES];
+	const std::size_t written = encodePoseDelta(buf, pose, QuantizedPose());
+	QuantizedPose decoded;
+	for (std::size_t i = 0; i < written; ++i) {
+		BOOST_CHECK_EQUAL(decodePoseDelta(buf, i, QuantizedPose(), decoded), 0);
+	}
+
+	const unsigned char badFlags[] = {0x80, 0, 0, 0, 0, 0, 0};
+	BOOST_CHECK_THROW(decodePoseDelta(badFlags, sizeof(badFlags), QuantizedPose(), decoded), std::runtime_error);
+	const unsigned char tooLong[] = {0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0, 0, 0, 0, 0};
+	BOOST_CHECK_THROW(decodePoseDelta(tooLong, sizeof(tooLong), QuantizedPose(), decoded), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidInputs) {
+	BOOST_CHECK_THROW(PoseQuantizer(0.0), std::invalid_argument);
+	BOOST_CHECK_THROW(PoseQuantizer(0.001, 1), std::invalid_argument);
+	BOOST_CHECK_THROW(PoseQuantizer(0.001, 31), std::invalid_argument);
+	const PoseQuantizer quantizer(0.0001);
+	BOOST_CHECK_THROW(quantizer.quantize(Eigen::Vector3d(1e6, 0, 0), Eigen::Quaterniond::Identity()), std::out_of_range);
+}
@@ -22,7 +22,8 @@
 #include <Eigen/Core>
 
 // Standard includes
-// - none
+#include <vector>
+#include <set>
 
 using namespace boost::unit_test;
 namespace {
@@ -124,3 +125,144 @@ BOOST_AUTO_TEST_CASE(ThrowsThreeNotUnique) {
 	BOOST_CHECK_THROW(util::TieVector(x)(x)(x) = orig, std::logic_error);
 }
 
+
+BOOST_AUTO_TEST_CASE(ArrayElementTies) {
+	double arr[4] = {0, 0, 0, 0};
+	util::TieVector(arr[0], arr[1], arr[2], arr[3]) = Eigen::Vector4d(1, 2, 3, 4);
+	BOOST_CHECK_EQUAL(arr[0], 1);
+	BOOST_CHECK_EQUAL(arr[3], 4);
+	BOOST_CHECK_EQUAL(util::TieVector(arr[1], arr[2]), Eigen::Vector2d(2, 3));
+
+	/// Same values in reverse order
+	util::TieVector(arr[3], arr[2], arr[1], arr[0]) = Eigen::Vector4d(1, 2, 3, 4);
+	BOOST_CHECK_EQUAL(arr[0], 4);
+	BOOST_CHECK_EQUAL(arr[3], 1);
+	BOOST_CHECK_EQUAL(util::TieVector(arr[3], arr[2], arr[1], arr[0]), Eigen::Vector4d(1, 2, 3, 4));
+}
+
+BOOST_AUTO_TEST_CASE(ContiguousTies) {
+	double arr[4] = {0, 0, 0, 0};
+	util::TieVector(arr) = Eigen::Vector4d(1, 2, 3, 4);
+	BOOST_CHECK_EQUAL(arr[0], 1);
+	BOOST_CHECK_EQUAL(arr[3], 4);
+	BOOST_CHECK_EQUAL(util::TieVector(arr), Eigen::Vector4d(1, 2, 3, 4));
+
+	std::vector<double> values(6, 0);
+	util::TieVector<3>(&values[3]) = Eigen::Vector3d(5, 6, 7);
+	BOOST_CHECK_EQUAL(values[2], 0);
+	BOOST_CHECK_EQUAL(values[3], 5);
+	BOOST_CHECK_EQUAL(values[5], 7);
+	BOOST_CHECK_EQUAL(util::TieVector<2>(&values[4]), Eigen::Vector2d(6, 7));
+
+	/// A single element still makes a pointer tie
+	util::TieVector(arr[1]) = Eigen::Matrix<double, 1, 1>::Constant(9);
+	BOOST_CHECK_EQUAL(arr[1], 9);
+}
+
+BOOST_AUTO_TEST_CASE(ExpressionAssign) {
+	double x, y, z;
+	const Eigen::Matrix3d rot(Eigen::Matrix3d::Identity() * 2);
+	util::TieVector(x, z, y) = rot * Eigen::Vector3d(1, 2, 3) + Eigen::Vector3d::Ones();
+	BOOST_CHECK_EQUAL(util::TieVector(x, y, z), Eigen::Vector3d(3, 7, 5));
+
+	double v[3] = {1, 2, 3};
+	util::TieVector(v[0], v[1], v[2]) = rot * util::TieVector(v[0], v[1], v[2]).convert();
+	BOOST_CHECK_EQUAL(util::TieVector(v[0], v[1], v[2]), Eigen::Vector3d(2, 4, 6));
+}
+
+BOOST_AUTO_TEST_CASE(LargerTieLoops) {
+	double a, b, c, d, e;
+	typedef Eigen::Matrix<double, 5, 1> Vector5d;
+	const Vector5d orig(Vector5d::LinSpaced(5, 1, 5));
+	util::TieVector(a, b, c, d)(e) = orig;
+	BOOST_CHECK_EQUAL(util::TieVector(a, b, c, d)(e), orig);
+	BOOST_CHECK_EQUAL(e, 5);
+}
+
+BOOST_AUTO_TEST_CASE(HigherArityTies) {
+	double a, b, c, d, e, f, g, h;
+	typedef Eigen::Matrix<double, 8, 1> Vector8d;
+	Vector8d orig;
+	orig << 1, 2, 3, 4, 5, 6, 7, 8;
+	util::TieVector(a, b, c, d, e, f, g, h) = orig;
+	BOOST_CHECK_EQUAL(util::TieVector(a, b, c, d, e, f, g, h), orig);
+	BOOST_CHECK_EQUAL(h, 8);
+	BOOST_CHECK_THROW(util::TieVector(a, b, c, d, e, f, g, a) = orig, std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(ColumnTieElement) {
+	std::vector<double> xs(5, 0), ys(5, 0), zs(5, 0);
+	util::TieColumns(&xs[0], &ys[0], &zs[0])[2] = Eigen::Vector3d(1, 2, 3);
+	BOOST_CHECK_EQUAL(xs[2], 1);
+	BOOST_CHECK_EQUAL(ys[2], 2);
+	BOOST_CHECK_EQUAL(zs[2], 3);
+	BOOST_CHECK_EQUAL(xs[1], 0);
+
+	/// Eigen math on one element of SoA storage
+	const util::detail::ColumnTie<3, double> particles(util::TieColumns(&xs[0], &ys[0], &zs[0]));
+	particles[3] = particles[2].convert() * 2 + Eigen::Vector3d::UnitX();
+	BOOST_CHECK_EQUAL(particles[3], Eigen::Vector3d(3, 4, 6));
+}
+
+BOOST_AUTO_TEST_CASE(ColumnTieBulk) {
+	std::vector<float> xs(4), ys(4), zs(4);
+	Eigen::Matrix3Xf m(3, 4);
+	m << 1, 2, 3, 4,
+	5, 6, 7, 8,
+	9, 10, 11, 12;
+	util::TieColumns(&xs[0], &ys[0], &zs[0]) = m;
+	BOOST_CHECK_EQUAL(xs[3], 4);
+	BOOST_CHECK_EQUAL(ys[0], 5);
+	BOOST_CHECK_EQUAL(zs[2], 11);
+	BOOST_CHECK_EQUAL(util::TieColumns(&xs[0], &ys[0], &zs[0]).convert(4), m);
+
+	/// Expressions, including ones that read the tied arrays
+	const Eigen::Matrix3f scale(Eigen::Vector3f(1, 10, 100).asDiagonal());
+	util::TieColumns(&xs[0], &ys[0], &zs[0]) = scale * util::TieColumns(&xs[0], &ys[0], &zs[0]).convert(4);
+	BOOST_CHECK_EQUAL(ys[1], 60);
+	BOOST_CHECK_EQUAL(zs[3], 1200);
+
+	/// Partial bulk assignment only touches the leading positions
+	util::TieColumns(&xs[0], &ys[0], &zs[0]) = Eigen::Matrix3Xf::Zero(3, 2);
+	BOOST_CHECK_EQUAL(xs[1], 0);
+	BOOST_CHECK_EQUAL(xs[2], 3);
+}
+
+namespace {
+	/// Compare against a set for every assignment of pool elements to Dim slots
+	template<int Dim>
+	void checkCountUnique() {
+		double pool[Dim];
+		double * ptrs[Dim];
+		int digits[Dim] = {0};
+		for (;;) {
+			for (int i = 0; i < Dim; ++i) {
+				ptrs[i] = &pool[digits[i]];
+			}
+			const std::set<double *> expected(ptrs, ptrs + Dim);
+			BOOST_CHECK_EQUAL(util::detail::tieCountUnique<Dim>(ptrs), int(expected.size()));
+			int i = 0;
+			while (i < Dim && ++digits[i] == Dim) {
+				digits[i++] = 0;
+			}
+			if (i == Dim) {
+				break;
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(CountUniqueMatchesSet) {
+	checkCountUnique<1>();
+	checkCountUnique<2>();
+	checkCountUnique<3>();
+	checkCountUnique<4>();
+	checkCountUnique<5>();
+}
+
+BOOST_AUTO_TEST_CASE(ThrowsColumnTieNotUnique) {
+	std::vector<double> xs(3), zs(3);
+	BOOST_CHECK_THROW(util::TieColumns(&xs[0], &xs[0], &zs[0]) = Eigen::Matrix3d::Zero(), std::logic_error);
+	BOOST_CHECK_THROW(util::TieColumns(&xs[0], &xs[0], &zs[0])[1] = Eigen::Vector3d::Zero(), std::logic_error);
+	BOOST_CHECK_NO_THROW(util::TieColumns(&xs[0], &zs[0])[1] = Eigen::Vector2d::Zero());
+}
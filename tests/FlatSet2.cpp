@@ -0,0 +1,142 @@
+/** @date	2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE FlatSet2 tests
+
+// Internal Includes
+#include <util/FlatSet2.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Standard includes
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+namespace {
+	/// Edges of two triangles sharing the edge (1, 2): {0, 1, 2} and {1, 3, 2}
+	std::vector<Set2<int> > twoTriangles() {
+		std::vector<Set2<int> > edges;
+		edges.push_back(Set2<int>(0, 1));
+		edges.push_back(Set2<int>(1, 2));
+		edges.push_back(Set2<int>(2, 0));
+		edges.push_back(Set2<int>(1, 3));
+		edges.push_back(Set2<int>(3, 2));
+		edges.push_back(Set2<int>(2, 1));
+		return edges;
+	}
+
+	struct CollectNeighbors {
+		CollectNeighbors(std::map<int, std::size_t> & out) : _out(out) {}
+		void operator()(int neighbor, std::size_t id) {
+			_out[neighbor] = id;
+		}
+		std::map<int, std::size_t> & _out;
+	};
+}
+
+BOOST_AUTO_TEST_CASE(DefaultConstruction) {
+	FlatSet2<int> s;
+	BOOST_CHECK(s.empty());
+	BOOST_CHECK_EQUAL(s.size(), 0);
+	BOOST_CHECK_EQUAL(s.vertexCount(), 0);
+	BOOST_CHECK_EQUAL(s.find(Set2<int>(0, 1)), s.size());
+	BOOST_CHECK_EQUAL(s.degree(0), 0);
+}
+
+BOOST_AUTO_TEST_CASE(BulkConstructionDeduplicates) {
+	std::vector<Set2<int> > edges(twoTriangles());
+	FlatSet2<int> s(edges.begin(), edges.end());
+	BOOST_CHECK_EQUAL(s.size(), 5);
+	BOOST_CHECK_EQUAL(s.vertexCount(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(SortedIteration) {
+	std::vector<Set2<int> > edges(twoTriangles());
+	FlatSet2<int> s(edges.begin(), edges.end());
+	BOOST_CHECK(std::adjacent_find(s.begin(), s.end(), std::not2(std::less<Set2<int> >())) == s.end());
+	std::size_t id = 0;
+	for (FlatSet2<int>::const_iterator it = s.begin(), e = s.end(); it != e; ++it, ++id) {
+		BOOST_CHECK(*it == s[id]);
+	}
+	BOOST_CHECK_EQUAL(id, s.size());
+}
+
+BOOST_AUTO_TEST_CASE(FindRoundTrip) {
+	std::vector<Set2<int> > edges(twoTriangles());
+	FlatSet2<int> s(edges.begin(), edges.end());
+	for (std::size_t i = 0; i < edges.size(); ++i) {
+		const std::size_t id = s.find(edges[i]);
+		BOOST_REQUIRE_LT(id, s.size());
+		BOOST_CHECK(s[id] == edges[i]);
+	}
+	BOOST_CHECK(!s.contains(Set2<int>(0, 3)));
+	BOOST_CHECK(!s.contains(Set2<int>(3, 7)));
+	BOOST_CHECK(!s.contains(Set2<int>(-1, 2)));
+	/// Every pair, present or not, through the hash index
+	for (int a = 0; a < 6; ++a) {
+		for (int b = 0; b < 6; ++b) {
+			const bool present = std::find(edges.begin(), edges.end(), Set2<int>(a, b)) != edges.end();
+			BOOST_CHECK_EQUAL(s.contains(Set2<int>(a, b)), present);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(NeighborRanges) {
+	std::vector<Set2<int> > edges(twoTriangles());
+	FlatSet2<int> s(edges.begin(), edges.end());
+
+	BOOST_CHECK_EQUAL(s.degree(0), 2);
+	BOOST_CHECK_EQUAL(s.degree(1), 3);
+	BOOST_CHECK_EQUAL(s.degree(2), 3);
+	BOOST_CHECK_EQUAL(s.degree(3), 2);
+	BOOST_CHECK_EQUAL(s.degree(4), 0);
+
+	std::map<int, std::size_t> neighbors;
+	s.forEachNeighbor(2, CollectNeighbors(neighbors));
+	BOOST_REQUIRE_EQUAL(neighbors.size(), 3);
+	BOOST_CHECK_EQUAL(neighbors[0], s.find(Set2<int>(0, 2)));
+	BOOST_CHECK_EQUAL(neighbors[1], s.find(Set2<int>(1, 2)));
+	BOOST_CHECK_EQUAL(neighbors[3], s.find(Set2<int>(2, 3)));
+}
+
+BOOST_AUTO_TEST_CASE(MatchesMapIDs) {
+	std::vector<Set2<int> > edges;
+	for (int i = 0; i < 200; ++i) {
+		edges.push_back(Set2<int>(i, (i * 37 + 11) % 200));
+		edges.push_back(Set2<int>(i, (i + 1) % 200));
+	}
+	std::map<Set2<int>, std::size_t> m;
+	for (std::size_t i = 0; i < edges.size(); ++i) {
+		m.insert(std::make_pair(edges[i], 0));
+	}
+	std::size_t id = 0;
+	for (std::map<Set2<int>, std::size_t>::iterator it = m.begin(); it != m.end(); ++it, ++id) {
+		it->second = id;
+	}
+
+	FlatSet2<int> s(edges.begin(), edges.end());
+	BOOST_REQUIRE_EQUAL(s.size(), m.size());
+	for (std::size_t i = 0; i < edges.size(); ++i) {
+		BOOST_CHECK_EQUAL(s.find(edges[i]), m[edges[i]]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ThrowsOnNegative) {
+	std::vector<Set2<int> > edges;
+	edges.push_back(Set2<int>(-1, 2));
+	BOOST_CHECK_THROW(FlatSet2<int>(edges.begin(), edges.end()), std::out_of_range);
+}
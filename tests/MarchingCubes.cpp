@@ -0,0 +1,247 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE MarchingCubes
+
+// Internal Includes
+#include <util/MarchingCubes.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+// Standard includes
+#include <vector>
+#include <map>
+#include <set>
+#include <utility>
+#include <cstdlib>
+
+using namespace boost::unit_test;
+using namespace util;
+
+/// Signed distance to a sphere, sampled on an n x n x n grid of unit spacing
+template<typename Scalar>
+std::vector<Scalar> sphereGrid(int n, Scalar radius) {
+	std::vector<Scalar> values(n * n * n);
+	const Scalar center = Scalar(n - 1) / 2;
+	for (int z = 0; z < n; ++z) {
+		for (int y = 0; y < n; ++y) {
+			for (int x = 0; x < n; ++x) {
+				values[(z * n + y) * n + x] = Eigen::Matrix<Scalar, 3, 1>(x - center, y - center, z - center).norm() - radius;
+			}
+		}
+	}
+	return values;
+}
+
+/// Checks the mesh is closed and consistently oriented: every directed
+/// edge is used once, and its reverse once.
+template<typename Scalar>
+void checkClosed(IsosurfaceMesh<Scalar> const& mesh) {
+	typedef std::pair<stdint::uint32_t, stdint::uint32_t> DirectedEdge;
+	std::map<DirectedEdge, int> edges;
+	for (std::size_t i = 0; i < mesh.indices.size(); i += 3) {
+		for (int j = 0; j < 3; ++j) {
+			++edges[DirectedEdge(mesh.indices[i + j], mesh.indices[i + (j + 1) % 3])];
+		}
+	}
+	bool closed = true;
+	for (typename std::map<DirectedEdge, int>::const_iterator it = edges.begin(); it != edges.end(); ++it) {
+		closed = closed && it->second == 1 && edges.count(DirectedEdge(it->first.second, it->first.first)) == 1;
+	}
+	BOOST_CHECK(closed);
+}
+
+BOOST_AUTO_TEST_CASE(TablesConsistent) {
+	for (int c = 0; c < 256; ++c) {
+		/// Complementary cases cut the same edges
+		BOOST_CHECK_EQUAL(MarchingCubesTables::edgeMask[c], MarchingCubesTables::edgeMask[255 - c]);
+		unsigned int used = 0;
+		for (signed char const* e = MarchingCubesTables::triangles[c]; *e >= 0; ++e) {
+			used |= 1u << *e;
+		}
+		BOOST_CHECK_EQUAL(used, MarchingCubesTables::edgeMask[c]);
+		/// No triangle lies in a cube face
+		for (signed char const* e = MarchingCubesTables::triangles[c]; *e >= 0; e += 3) {
+			for (int f = 0; f < 2; ++f) {
+				const unsigned char face = CubeTables::edgeFaces[e[0]][f];
+				const bool inFace = (face == CubeTables::edgeFaces[e[1]][0] || face == CubeTables::edgeFaces[e[1]][1]) &&
+				                    (face == CubeTables::edgeFaces[e[2]][0] || face == CubeTables::edgeFaces[e[2]][1]);
+				BOOST_CHECK(!inFace);
+			}
+		}
+		/// An edge is cut exactly when its ends are on different sides
+		for (int e = 0; e < 12; ++e) {
+			const unsigned char * ends = CubeTables::edgeVertices[e];
+			const bool cut = ((c >> ends[0]) & 1) != ((c >> ends[1]) & 1);
+			BOOST_CHECK_EQUAL(cut, ((MarchingCubesTables::edgeMask[c] >> e) & 1) != 0);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ClassifyMatchesScalar) {
+	std::vector<float> f(37);
+	std::vector<double> d(37);
+	for (std::size_t i = 0; i < f.size(); ++i) {
+		f[i] = float(std::rand()) / RAND_MAX - 0.5f;
+		d[i] = f[i];
+	}
+	std::vector<unsigned char> simd(f.size()), scalar(f.size());
+	detail::marchingCubesClassify(&f[0], f.size(), 0.1f, &simd[0]);
+	detail::marchingCubesClassifyScalar(&f[0], f.size(), 0.1f, &scalar[0]);
+	BOOST_CHECK_EQUAL_COLLECTIONS(simd.begin(), simd.end(), scalar.begin(), scalar.end());
+
+	detail::marchingCubesClassify(&d[0], d.size(), 0.1, &simd[0]);
+	detail::marchingCubesClassifyScalar(&d[0], d.size(), 0.1, &scalar[0]);
+	BOOST_CHECK_EQUAL_COLLECTIONS(simd.begin(), simd.end(), scalar.begin(), scalar.end());
+}
+
+BOOST_AUTO_TEST_CASE(CombineCases) {
+	/// 20 cells: exercises both the SIMD and the scalar tail
+	const std::size_t n = 20;
+	std::vector<unsigned char> rows[4];
+	for (int r = 0; r < 4; ++r) {
+		for (std::size_t i = 0; i <= n; ++i) {
+			rows[r].push_back(std::rand() & 1);
+		}
+	}
+	std::vector<unsigned char> cases(n);
+	BOOST_CHECK(detail::marchingCubesCombineCases(&rows[0][0], &rows[1][0], &rows[2][0], &rows[3][0], n, &cases[0]));
+	for (std::size_t i = 0; i < n; ++i) {
+		unsigned int expected = 0;
+		for (unsigned int v = 0; v < 8; ++v) {
+			/// Vertex bits: x offset, then row (y), then plane (z)
+			expected |= rows[v >> 1][i + (v & 1)] << v;
+		}
+		BOOST_CHECK_EQUAL(cases[i], expected);
+	}
+
+	std::vector<unsigned char> ones(n + 1, 1);
+	BOOST_CHECK(!detail::marchingCubesCombineCases(&ones[0], &ones[0], &ones[0], &ones[0], n, &cases[0]));
+	BOOST_CHECK_EQUAL(cases[n - 1], 0xff);
+}
+
+BOOST_AUTO_TEST_CASE(SingleCorner) {
+	/// Only vertex 0 below the isovalue
+	float values[8] = {-1, 1, 1, 1, 1, 1, 1, 1};
+	MarchingCubes<float> mc(values, Eigen::Vector3i(2, 2, 2));
+	IsosurfaceMesh<float> mesh;
+	mc.extract(0, mesh);
+	BOOST_REQUIRE_EQUAL(mesh.triangleCount(), 1);
+	BOOST_REQUIRE_EQUAL(mesh.vertices.size(), 3);
+	for (int i = 0; i < 3; ++i) {
+		BOOST_CHECK_CLOSE(mesh.vertices[i].sum(), 0.5f, 0.0001);
+	}
+	/// Faces away from the corner below the isovalue
+	const Eigen::Vector3f normal = (mesh.vertices[mesh.indices[1]] - mesh.vertices[mesh.indices[0]]).cross(
+	                                   mesh.vertices[mesh.indices[2]] - mesh.vertices[mesh.indices[0]]);
+	BOOST_CHECK_GT(normal.dot(Eigen::Vector3f::Ones()), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SphereIsClosed) {
+	const int n = 20;
+	const double radius = 6.3;
+	const std::vector<double> values = sphereGrid(n, radius);
+	const Eigen::Vector3d origin(-1, 2, 3);
+	const Eigen::Vector3d spacing(0.5, 0.5, 0.5);
+	MarchingCubes<double> mc(&values[0], Eigen::Vector3i::Constant(n), origin, spacing);
+	IsosurfaceMesh<double> mesh;
+	mc.extract(0, mesh);
+	BOOST_REQUIRE(mesh.triangleCount() > 0);
+	checkClosed(mesh);
+
+	const Eigen::Vector3d center = origin + spacing * (n - 1) / 2;
+	bool onSphere = true;
+	bool outward = true;
+	for (std::size_t i = 0; i < mesh.vertices.size(); ++i) {
+		const double r = (mesh.vertices[i] - center).norm() / spacing[0];
+		onSphere = onSphere && r > radius - 0.05 && r < radius + 0.05;
+	}
+	for (std::size_t i = 0; i < mesh.indices.size(); i += 3) {
+		const Eigen::Vector3d a = mesh.vertices[mesh.indices[i]];
+		const Eigen::Vector3d normal = (mesh.vertices[mesh.indices[i + 1]] - a).cross(mesh.vertices[mesh.indices[i + 2]] - a);
+		outward = outward && normal.dot(a - center) > 0;
+	}
+	BOOST_CHECK(onSphere);
+	BOOST_CHECK(outward);
+}
+
+BOOST_AUTO_TEST_CASE(VerticesAreShared) {
+	const int n = 16;
+	const std::vector<float> values = sphereGrid(n, 5.2f);
+	MarchingCubes<float> mc(&values[0], Eigen::Vector3i::Constant(n));
+	IsosurfaceMesh<float> mesh;
+	mc.extract(0, mesh);
+	std::set<std::vector<float> > unique;
+	for (std::size_t i = 0; i < mesh.vertices.size(); ++i) {
+		unique.insert(std::vector<float>(mesh.vertices[i].data(), mesh.vertices[i].data() + 3));
+	}
+	BOOST_CHECK_EQUAL(unique.size(), mesh.vertices.size());
+	/// A closed genus-0 triangle mesh: V - E + F = 2, with E = 3F / 2
+	BOOST_CHECK_EQUAL(2 * mesh.vertices.size(), mesh.triangleCount() + 4);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedMatchesSingle) {
+	/// Two nearly touching spheres
+	const int n = 24;
+	std::vector<float> values = sphereGrid(n, 4.1f);
+	const std::vector<float> shifted = sphereGrid(n, 3.7f);
+	for (int z = 0; z < n; ++z) {
+		for (int y = 0; y < n; ++y) {
+			for (int x = 0; x < n; ++x) {
+				const int offset = 6 * n * n + 5 * n + 4;
+				const int i = (z * n + y) * n + x;
+				const float other = i >= offset ? shifted[i - offset] : 100;
+				values[i] = std::min(values[i], other);
+			}
+		}
+	}
+	MarchingCubes<float> mc(&values[0], Eigen::Vector3i::Constant(n));
+	IsosurfaceMesh<float> single;
+	mc.extract(0, single);
+	checkClosed(single);
+	for (unsigned int threads = 2; threads <= 5; ++threads) {
+		IsosurfaceMesh<float> threaded;
+		mc.extract(0, threaded, threads);
+		BOOST_CHECK(threaded.vertices == single.vertices);
+		BOOST_CHECK(threaded.indices == single.indices);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(RandomFieldIsManifold) {
+	/// Random signs hit every case, ambiguous faces included; the positive
+	/// border keeps each surface inside the grid, so it must be closed.
+	const int n = 10;
+	for (int trial = 0; trial < 300; ++trial) {
+		std::vector<float> values(n * n * n, 1);
+		for (int z = 1; z < n - 1; ++z) {
+			for (int y = 1; y < n - 1; ++y) {
+				for (int x = 1; x < n - 1; ++x) {
+					values[(z * n + y) * n + x] = (std::rand() & 1) ? 1.f : -1.f;
+				}
+			}
+		}
+		MarchingCubes<float> mc(&values[0], Eigen::Vector3i::Constant(n));
+		IsosurfaceMesh<float> mesh;
+		mc.extract(0, mesh);
+		checkClosed(mesh);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(InvalidArguments) {
+	float values[8] = {0};
+	BOOST_CHECK_THROW(MarchingCubes<float>(NULL, Eigen::Vector3i(2, 2, 2)), std::invalid_argument);
+	BOOST_CHECK_THROW(MarchingCubes<float>(values, Eigen::Vector3i(2, 1, 4)), std::invalid_argument);
+	MarchingCubes<float> mc(values, Eigen::Vector3i(2, 2, 2));
+	MarchingCubes<float>::Slab slab;
+	BOOST_CHECK_THROW(mc.extractSlab(0, 0, 2, slab), std::out_of_range);
+	BOOST_CHECK_THROW(mc.extractSlab(0, 1, 1, slab), std::out_of_range);
+}
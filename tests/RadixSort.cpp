@@ -0,0 +1,75 @@
+/** @date	2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE RadixSort tests
+
+// Internal Includes
+#include <util/RadixSort.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+BOOST_AUTO_TEST_CASE(EmptyAndSingle) {
+	std::vector<stdint::uint64_t> v;
+	radixSort(v);
+	BOOST_CHECK(v.empty());
+
+	v.push_back(42);
+	radixSort(v);
+	BOOST_REQUIRE_EQUAL(v.size(), 1);
+	BOOST_CHECK_EQUAL(v[0], 42u);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesStdSort64) {
+	std::srand(1);
+	std::vector<stdint::uint64_t> v;
+	for (int i = 0; i < 10000; ++i) {
+		v.push_back((stdint::uint64_t(std::rand()) << 40) ^ (stdint::uint64_t(std::rand()) << 16) ^ std::rand());
+	}
+	std::vector<stdint::uint64_t> expected(v);
+	std::sort(expected.begin(), expected.end());
+	radixSort(v);
+	BOOST_CHECK(v == expected);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesStdSortSmallKeys) {
+	std::srand(2);
+	std::vector<stdint::uint32_t> v;
+	std::vector<stdint::uint32_t> scratch;
+	for (int i = 0; i < 10000; ++i) {
+		v.push_back(std::rand() % 300);
+	}
+	std::vector<stdint::uint32_t> expected(v);
+	std::sort(expected.begin(), expected.end());
+	radixSort(v, scratch);
+	BOOST_CHECK(v == expected);
+}
+
+BOOST_AUTO_TEST_CASE(SortsSubrange) {
+	std::srand(3);
+	std::vector<stdint::uint16_t> v;
+	for (int i = 0; i < 1000; ++i) {
+		v.push_back(std::rand());
+	}
+	std::vector<stdint::uint16_t> expected(v);
+	std::sort(expected.begin() + 100, expected.begin() + 900);
+	std::vector<stdint::uint16_t> scratch(800);
+	radixSort(&v[100], 800, &scratch[0]);
+	BOOST_CHECK(v == expected);
+}
@@ -13,9 +13,11 @@
 
 // Library/third-party includes
 #include <BoostTestTargetConfig.h>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 // Standard includes
-// - none
+#include <climits>
 
 using namespace boost::unit_test;
 using namespace util;
@@ -89,4 +91,124 @@ BOOST_AUTO_TEST_CASE(SameRangeCrossChecking) {
 	BOOST_CHECK_THROW(strict = RangedLoose(7), std::out_of_range);
 }
 
+BOOST_AUTO_TEST_CASE(ResultRanges) {
+	typedef RangedInt<1, 5> A;
+	typedef RangedInt < -2, 3 > B;
+	BOOST_STATIC_ASSERT((boost::is_same<detail::RangedSum<A, B>::type, RangedInt < -1, 8 > >::value));
+	BOOST_STATIC_ASSERT((boost::is_same<detail::RangedDifference<A, B>::type, RangedInt < -2, 7 > >::value));
+	BOOST_STATIC_ASSERT((boost::is_same<detail::RangedProduct<A, B>::type, RangedInt < -10, 15 > >::value));
+	BOOST_STATIC_ASSERT((boost::is_same<detail::RangedProduct<B, B>::type, RangedInt < -6, 9 > >::value));
+	BOOST_STATIC_ASSERT((boost::is_same<detail::RangedNegation<A>::type, RangedInt < -5, -1 > >::value));
+	/// Unchecked if either operand is
+	typedef RangedInt<0, 1, NeverCheck> Loose;
+	BOOST_STATIC_ASSERT(!detail::RangedSum<A, Loose>::type::checked);
+	BOOST_STATIC_ASSERT(!detail::RangedSum<Loose, A>::type::checked);
+	BOOST_STATIC_ASSERT(detail::RangedSum<A, B>::type::checked);
+
+	const RangedInt < -1, 8 > sum = A(5) + B(-2);
+	BOOST_CHECK_EQUAL(sum, 3);
+	BOOST_CHECK_EQUAL(A(2) - B(3), -1);
+	BOOST_CHECK_EQUAL(A(5) * B(-2), -10);
+	BOOST_CHECK_EQUAL(-A(4), -4);
+}
+
+namespace {
+	/// Tells a plain int result from a ranged one
+	template<typename T>
+	bool isPlainInt(T const&) {
+		return false;
+	}
+
+	bool isPlainInt(int) {
+		return true;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ResultRangeOverflow) {
+	/// Result bounds outside int: the operands decay to int instead
+	typedef RangedInt<0, 100000> Big;
+	typedef RangedInt<0, INT_MAX> Huge;
+	typedef RangedInt<INT_MIN, 0> Negative;
+	BOOST_CHECK(isPlainInt(Big(500) * Big(700)));
+	BOOST_CHECK_EQUAL(Big(500) * Big(700), 350000);
+	BOOST_CHECK(isPlainInt(Huge(5) + Huge(6)));
+	BOOST_CHECK_EQUAL(Huge(5) + Huge(6), 11);
+	BOOST_CHECK(isPlainInt(Negative(-3) - Big(4)));
+	BOOST_CHECK_EQUAL(Negative(-3) - Big(4), -7);
+	BOOST_CHECK(isPlainInt(-Negative(-3)));
+	BOOST_CHECK_EQUAL(-Negative(-3), 3);
+	/// Bounds that fit still give a ranged result
+	BOOST_CHECK(!isPlainInt(Big(5) + Big(6)));
+	BOOST_CHECK(!isPlainInt(-Huge(3)));
+	BOOST_STATIC_ASSERT((boost::is_same < detail::RangedNegation<Huge>::type, RangedInt < -INT_MAX, 0 > >::value));
+}
+
+BOOST_AUTO_TEST_CASE(ResultAssignmentChecking) {
+	typedef RangedInt<0, 3> Small;
+	typedef RangedInt<0, 9> Wide;
+	/// Provably in range: compiles to no check at all
+	Wide wide(Small(3) + Small(3));
+	BOOST_CHECK_EQUAL(wide, 6);
+	BOOST_CHECK_NO_THROW(wide = Small(3) * Small(3));
+	/// Possibly out of range: checked
+	Small small(Small(1) + Small(2));
+	BOOST_CHECK_EQUAL(small, 3);
+	BOOST_CHECK_THROW(small = Small(2) + Small(2), std::out_of_range);
+	BOOST_CHECK_THROW(Small(Small(0) - Small(1)), std::out_of_range);
+	/// An unchecked operand makes the result checked on assignment
+	typedef RangedInt<0, 3, NeverCheck> Loose;
+	BOOST_CHECK_THROW(wide = Small(3) + Loose(7), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(CompoundAssignment) {
+	typedef RangedInt<0, 10> Ranged;
+	Ranged val(2);
+	val += RangedInt<0, 3>(3);
+	BOOST_CHECK_EQUAL(val, 5);
+	val *= RangedInt<1, 2>(2);
+	BOOST_CHECK_EQUAL(val, 10);
+	val -= 4;
+	BOOST_CHECK_EQUAL(val, 6);
+	BOOST_CHECK_THROW((val += RangedInt<0, 5>(5)), std::out_of_range);
+	BOOST_CHECK_THROW(val -= 20, std::out_of_range);
+}
 
+BOOST_AUTO_TEST_CASE(StorageSize) {
+	BOOST_STATIC_ASSERT((boost::is_same<RangedInt<0, 7>::storage_type, unsigned char>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<RangedInt<0, 65535>::storage_type, unsigned short>::value));
+	BOOST_STATIC_ASSERT((boost::is_same < RangedInt < -100, 100 >::storage_type, signed char >::value));
+	BOOST_STATIC_ASSERT((boost::is_same < RangedInt < -1, 200 >::storage_type, short >::value));
+	BOOST_STATIC_ASSERT((boost::is_same < RangedInt < -40000, 5 >::storage_type, int >::value));
+	BOOST_STATIC_ASSERT((boost::is_same<RangedInt<0, 7, NeverCheck>::storage_type, unsigned char>::value));
+	BOOST_CHECK_EQUAL(sizeof(RangedInt<0, 7>), 1);
+	BOOST_CHECK_EQUAL(sizeof(RangedInt<0, 7>[64]), 64);
+	BOOST_CHECK_EQUAL(sizeof(RangedInt<0, 7, NeverCheck>[64]), 64);
+	BOOST_CHECK_EQUAL(sizeof(RangedInt < -1, 200 >), 2);
+
+	typedef RangedInt < -100, 100 > Ranged;
+	BOOST_CHECK_EQUAL(Ranged(-100), -100);
+	BOOST_CHECK_EQUAL(Ranged(100), 100);
+	BOOST_CHECK_EQUAL((RangedInt<0, 255>(255)), 255);
+}
+
+BOOST_AUTO_TEST_CASE(CheckedBeforeNarrowing) {
+	/// These would wrap into range if narrowed first
+	typedef RangedInt<0, 7> Ranged;
+	BOOST_CHECK_THROW(Ranged(256), std::out_of_range);
+	BOOST_CHECK_THROW(Ranged(-256), std::out_of_range);
+	Ranged val(3);
+	BOOST_CHECK_THROW(val = 259, std::out_of_range);
+	BOOST_CHECK_EQUAL(val, 3);
+	BOOST_CHECK_THROW((val = RangedInt<0, 1000>(264)), std::out_of_range);
+	BOOST_CHECK_THROW((val += RangedInt<0, 255>(253)), std::out_of_range);
+	BOOST_CHECK_EQUAL(val, 3);
+
+	/// Unchecked values must be in range (Loose(259) is a precondition
+	/// violation), but are still checked against a narrower checked type.
+	typedef RangedInt<0, 9, NeverCheck> Loose;
+	BOOST_CHECK_THROW(Ranged(Loose(8)), std::out_of_range);
+	BOOST_CHECK_THROW(val = Loose(5) + Loose(4), std::out_of_range);
+	BOOST_CHECK_EQUAL(val, 3);
+	val = Loose(7);
+	BOOST_CHECK_EQUAL(val, 7);
+}
@@ -260,3 +260,105 @@ BOOST_AUTO_TEST_CASE(ThreeParam3DSaturateNeg) {
 	BOOST_CHECK(result == true);
 }
 //--------------------------------------------------------------------
+
+//Generic fixed-size tests---------------------------------------------
+typedef Eigen::Matrix<double, 6, 1> Vector6d;
+
+BOOST_AUTO_TEST_CASE(Generic2DSaturate) {
+	Eigen::Vector2d vec(3.0, 4.0);
+	bool result = util::saturate(vec, 2.5);
+
+	BOOST_CHECK_CLOSE(vec[0], 1.5, 0.0001);
+	BOOST_CHECK_CLOSE(vec[1], 2.0, 0.0001);
+	BOOST_CHECK(result == true);
+}
+
+BOOST_AUTO_TEST_CASE(Generic4fNoSaturate) {
+	Eigen::Vector4f orig(1.0f, -1.0f, 1.0f, -1.0f);
+	Eigen::Vector4f vec = orig;
+	bool result = util::saturate(vec, 5.0f);
+
+	BOOST_CHECK_EQUAL(orig, vec);
+	BOOST_CHECK(result == false);
+}
+
+BOOST_AUTO_TEST_CASE(Generic4fSaturate) {
+	Eigen::Vector4f vec(2.0f, -2.0f, 2.0f, -2.0f);
+	bool result = util::saturate(vec, 2.0f);
+
+	for (unsigned int i = 0; i < 4; i++) {
+		BOOST_CHECK_CLOSE(std::fabs(vec[i]), 1.0f, 0.0001f);
+	}
+	BOOST_CHECK(result == true);
+}
+
+BOOST_AUTO_TEST_CASE(Generic6DPairedSaturate) {
+	Vector6d vec = Vector6d::Constant(2.0);
+	Vector6d othervec = Vector6d::Constant(4.0);
+	double mxMagnitude = sqrt(6.0);
+	bool result = util::saturate(vec, mxMagnitude, othervec);
+
+	for (unsigned int i = 0; i < 6; i++) {
+		BOOST_CHECK_CLOSE(vec[i], 1.0, 0.0001);
+		BOOST_CHECK_CLOSE(othervec[i], 2.0, 0.0001);
+	}
+	BOOST_CHECK(result == true);
+}
+
+BOOST_AUTO_TEST_CASE(GenericBlockSaturate) {
+	Vector6d wrench;
+	wrench << 0.0, 0.0, 3.0, 0.0, 0.0, 3.0;
+	bool result = util::saturate(wrench.head<3>(), 2.0);
+
+	BOOST_CHECK_CLOSE(wrench[2], 2.0, 0.0001);
+	BOOST_CHECK_CLOSE(wrench[5], 3.0, 0.0001);
+	BOOST_CHECK(result == true);
+}
+
+BOOST_AUTO_TEST_CASE(GenericMatchesVector3d) {
+	Eigen::Vector3d orig(-4.0, 1.0, 2.5);
+	Eigen::Vector3d vec = orig;
+	Eigen::Vector3d generic = orig;
+	util::saturate(vec, 2.0);
+	util::saturate(generic.head<3>(), 2.0);
+
+	BOOST_CHECK_EQUAL(vec, generic);
+}
+
+BOOST_AUTO_TEST_CASE(PerAxisClampOnly) {
+	Eigen::Vector3d vec(3.0, -0.5, -3.0);
+	bool result = util::saturatePerAxis(vec, 1.0, 10.0);
+
+	BOOST_CHECK_EQUAL(vec, Eigen::Vector3d(1.0, -0.5, -1.0));
+	BOOST_CHECK(result == true);
+}
+
+BOOST_AUTO_TEST_CASE(PerAxisNoSaturate) {
+	Eigen::Vector3d orig(0.5, -0.5, 0.25);
+	Eigen::Vector3d vec = orig;
+	bool result = util::saturatePerAxis(vec, 1.0, 10.0);
+
+	BOOST_CHECK_EQUAL(orig, vec);
+	BOOST_CHECK(result == false);
+}
+
+BOOST_AUTO_TEST_CASE(PerAxisThenMagnitude) {
+	Eigen::Vector3d vec(5.0, -5.0, 0.0);
+	bool result = util::saturatePerAxis(vec, 3.0, sqrt(2.0));
+
+	BOOST_CHECK_CLOSE(vec[0], 1.0, 0.0001);
+	BOOST_CHECK_CLOSE(vec[1], -1.0, 0.0001);
+	BOOST_CHECK_EQUAL(vec[2], 0.0);
+	BOOST_CHECK(result == true);
+}
+
+BOOST_AUTO_TEST_CASE(PerAxisLimitsVector) {
+	Vector6d wrench = Vector6d::Constant(10.0);
+	Vector6d limits;
+	limits << 4.0, 4.0, 4.0, 1.0, 1.0, 1.0;
+	bool result = util::saturatePerAxis(wrench, limits, 100.0);
+
+	BOOST_CHECK_EQUAL(wrench, limits);
+	BOOST_CHECK(result == true);
+}
+//--------------------------------------------------------------------
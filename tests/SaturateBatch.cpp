@@ -0,0 +1,216 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE SaturateBatch tests
+
+// Internal Includes
+#include <util/SaturateBatch.h>
+#include <util/Saturate.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+
+// Standard includes
+#include <vector>
+#include <cstdlib>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+namespace {
+	/// An odd count, so the SIMD loops have a scalar tail
+	const std::size_t N = 131;
+	const double MAX_MAGNITUDE = 2.0;
+
+	std::vector<Eigen::Vector3d> makeVectors(std::size_t n, unsigned int seed) {
+		std::srand(seed);
+		std::vector<Eigen::Vector3d> ret;
+		for (std::size_t i = 0; i < n; ++i) {
+			ret.push_back(Eigen::Vector3d::Random() * 3.0);
+		}
+		/// Include a zero vector and one exactly at the limit
+		ret[5] = Eigen::Vector3d::Zero();
+		ret[6] = Eigen::Vector3d(0.0, 0.0, MAX_MAGNITUDE);
+		return ret;
+	}
+
+	struct SoA {
+		explicit SoA(std::vector<Eigen::Vector3d> const& v) {
+			for (std::size_t i = 0; i < v.size(); ++i) {
+				x.push_back(v[i][0]);
+				y.push_back(v[i][1]);
+				z.push_back(v[i][2]);
+			}
+		}
+		Eigen::Vector3d get(std::size_t i) const {
+			return Eigen::Vector3d(x[i], y[i], z[i]);
+		}
+		std::vector<double> x;
+		std::vector<double> y;
+		std::vector<double> z;
+	};
+
+	bool testBit(std::vector<stdint::uint64_t> const& mask, std::size_t i) {
+		return (mask[i / 64] >> (i % 64)) & 1;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SoAMatchesSingle) {
+	std::vector<Eigen::Vector3d> expected = makeVectors(N, 1);
+	SoA soa(expected);
+	std::vector<stdint::uint64_t> mask(saturateMaskWords(N), ~stdint::uint64_t(0));
+
+	std::vector<bool> expectedSaturated;
+	std::size_t expectedCount = 0;
+	for (std::size_t i = 0; i < N; ++i) {
+		expectedSaturated.push_back(saturate(expected[i], MAX_MAGNITUDE));
+		expectedCount += expectedSaturated[i];
+	}
+	const std::size_t count = saturateSoA(&soa.x[0], &soa.y[0], &soa.z[0], N, MAX_MAGNITUDE, &mask[0]);
+
+	BOOST_CHECK_EQUAL(count, expectedCount);
+	BOOST_CHECK(count > 0 && count < N);
+	for (std::size_t i = 0; i < N; ++i) {
+		BOOST_CHECK_EQUAL(testBit(mask, i), expectedSaturated[i]);
+		for (int j = 0; j < 3; ++j) {
+			BOOST_CHECK_CLOSE(soa.get(i)[j], expected[i][j], 0.0001);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SoAPairedMatchesSingle) {
+	std::vector<Eigen::Vector3d> expected = makeVectors(N, 2);
+	std::vector<Eigen::Vector3d> expectedOther = makeVectors(N, 3);
+	SoA soa(expected);
+	SoA other(expectedOther);
+
+	std::size_t expectedCount = 0;
+	for (std::size_t i = 0; i < N; ++i) {
+		expectedCount += saturate(expected[i], MAX_MAGNITUDE, expectedOther[i]);
+	}
+	const std::size_t count = saturateSoA(&soa.x[0], &soa.y[0], &soa.z[0],
+	                                      &other.x[0], &other.y[0], &other.z[0], N, MAX_MAGNITUDE);
+
+	BOOST_CHECK_EQUAL(count, expectedCount);
+	for (std::size_t i = 0; i < N; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			BOOST_CHECK_CLOSE(soa.get(i)[j], expected[i][j], 0.0001);
+			BOOST_CHECK_CLOSE(other.get(i)[j], expectedOther[i][j], 0.0001);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(AoSMatchesSingle) {
+	std::vector<Eigen::Vector3d> expected = makeVectors(N, 4);
+	std::vector<Eigen::Vector3d> vecs = expected;
+	std::vector<stdint::uint64_t> mask(saturateMaskWords(N));
+
+	std::vector<bool> expectedSaturated;
+	for (std::size_t i = 0; i < N; ++i) {
+		expectedSaturated.push_back(saturate(expected[i], MAX_MAGNITUDE));
+	}
+	const std::size_t count = saturateAoS(&vecs[0], N, MAX_MAGNITUDE, &mask[0]);
+
+	std::size_t expectedCount = 0;
+	for (std::size_t i = 0; i < N; ++i) {
+		expectedCount += expectedSaturated[i];
+		BOOST_CHECK_EQUAL(testBit(mask, i), expectedSaturated[i]);
+		for (int j = 0; j < 3; ++j) {
+			BOOST_CHECK_CLOSE(vecs[i][j], expected[i][j], 0.0001);
+		}
+	}
+	BOOST_CHECK_EQUAL(count, expectedCount);
+}
+
+BOOST_AUTO_TEST_CASE(AoSPairedMatchesSingle) {
+	std::vector<Eigen::Vector3d> expected = makeVectors(N, 5);
+	std::vector<Eigen::Vector3d> expectedOther = makeVectors(N, 6);
+	std::vector<Eigen::Vector3d> vecs = expected;
+	std::vector<Eigen::Vector3d> others = expectedOther;
+
+	std::size_t expectedCount = 0;
+	for (std::size_t i = 0; i < N; ++i) {
+		expectedCount += saturate(expected[i], MAX_MAGNITUDE, expectedOther[i]);
+	}
+	BOOST_CHECK_EQUAL(saturateAoS(&vecs[0], &others[0], N, MAX_MAGNITUDE), expectedCount);
+	for (std::size_t i = 0; i < N; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			BOOST_CHECK_CLOSE(vecs[i][j], expected[i][j], 0.0001);
+			BOOST_CHECK_CLOSE(others[i][j], expectedOther[i][j], 0.0001);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(MaskMatchesSoAAndAoS) {
+	std::vector<Eigen::Vector3d> vecs = makeVectors(N, 7);
+	SoA soa(vecs);
+	std::vector<stdint::uint64_t> soaMask(saturateMaskWords(N));
+	std::vector<stdint::uint64_t> aosMask(saturateMaskWords(N));
+	saturateSoA(&soa.x[0], &soa.y[0], &soa.z[0], N, MAX_MAGNITUDE, &soaMask[0]);
+	saturateAoS(&vecs[0], N, MAX_MAGNITUDE, &aosMask[0]);
+	BOOST_CHECK(soaMask == aosMask);
+	/// Zero vector and vector exactly at the limit are untouched
+	BOOST_CHECK(!testBit(soaMask, 5));
+	BOOST_CHECK(!testBit(soaMask, 6));
+	BOOST_CHECK_EQUAL(soa.get(5), Eigen::Vector3d::Zero());
+	BOOST_CHECK_EQUAL(soa.get(6), Eigen::Vector3d(0.0, 0.0, MAX_MAGNITUDE));
+}
+
+BOOST_AUTO_TEST_CASE(EmptyBatch) {
+	BOOST_CHECK_EQUAL(saturateSoA(NULL, NULL, NULL, 0, MAX_MAGNITUDE), 0);
+	BOOST_CHECK_EQUAL(saturateAoS(static_cast<Eigen::Vector3d *>(NULL), 0, MAX_MAGNITUDE), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SoAFloatMatchesSingle) {
+	std::vector<Eigen::Vector3d> source = makeVectors(N, 8);
+	std::vector<float> x, y, z;
+	std::vector<Eigen::Vector3f> expected;
+	for (std::size_t i = 0; i < N; ++i) {
+		expected.push_back(source[i].cast<float>());
+		x.push_back(expected[i][0]);
+		y.push_back(expected[i][1]);
+		z.push_back(expected[i][2]);
+	}
+	std::vector<stdint::uint64_t> mask(saturateMaskWords(N));
+
+	std::size_t expectedCount = 0;
+	std::vector<bool> expectedSaturated;
+	for (std::size_t i = 0; i < N; ++i) {
+		expectedSaturated.push_back(saturate(expected[i], float(MAX_MAGNITUDE)));
+		expectedCount += expectedSaturated[i];
+	}
+	BOOST_CHECK_EQUAL(saturateSoA(&x[0], &y[0], &z[0], N, float(MAX_MAGNITUDE), &mask[0]), expectedCount);
+	for (std::size_t i = 0; i < N; ++i) {
+		BOOST_CHECK_EQUAL(testBit(mask, i), expectedSaturated[i]);
+		BOOST_CHECK_CLOSE(x[i], expected[i][0], 0.001f);
+		BOOST_CHECK_CLOSE(y[i], expected[i][1], 0.001f);
+		BOOST_CHECK_CLOSE(z[i], expected[i][2], 0.001f);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(AoSGenericDimension) {
+	typedef Eigen::Matrix<double, 6, 1> Vector6d;
+	std::srand(9);
+	std::vector<Vector6d> expected;
+	for (std::size_t i = 0; i < N; ++i) {
+		expected.push_back(Vector6d::Random() * 3.0);
+	}
+	std::vector<Vector6d> vecs = expected;
+
+	std::size_t expectedCount = 0;
+	for (std::size_t i = 0; i < N; ++i) {
+		expectedCount += saturate(expected[i], MAX_MAGNITUDE);
+	}
+	BOOST_CHECK_EQUAL(saturateAoS(&vecs[0], N, MAX_MAGNITUDE), expectedCount);
+	for (std::size_t i = 0; i < N; ++i) {
+		BOOST_CHECK_EQUAL(vecs[i], expected[i]);
+	}
+}
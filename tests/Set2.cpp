@@ -15,9 +15,12 @@
 // Library/third-party includes
 #include <BoostTestTargetConfig.h>
 
+#include <boost/unordered_set.hpp>
+
 // Standard includes
 #include <vector>
 #include <map>
+#include <string>
 #include <algorithm>
 
 
@@ -257,3 +260,88 @@ BOOST_AUTO_TEST_CASE(MapUpdate) {
 /// @todo Add tests for use in std::set
 /// @todo Add templated construction test in separate cpp
 
+BOOST_AUTO_TEST_CASE(UnpackedAccessorsReturnReferences) {
+	const Set2<int> a(10, 5);
+	int const& first = a.first();
+	BOOST_CHECK_EQUAL(&first, &a.first());
+	BOOST_CHECK_EQUAL(first, 5);
+}
+
+BOOST_AUTO_TEST_CASE(PackedNegativeOrdering) {
+	PackedSet2<int> a(-5, 3);
+	PackedSet2<int> b(-1, -7);
+	BOOST_CHECK_EQUAL(a.first(), -5);
+	BOOST_CHECK_EQUAL(a.second(), 3);
+	BOOST_CHECK_EQUAL(b.first(), -7);
+	BOOST_CHECK_EQUAL(b.second(), -1);
+
+	BOOST_CHECK(b < a);
+	BOOST_CHECK(!(a < b));
+	BOOST_CHECK(b.key() < a.key());
+}
+
+BOOST_AUTO_TEST_CASE(PackedExtremes) {
+	PackedSet2<int> a(2147483647, -2147483647 - 1);
+	BOOST_CHECK_EQUAL(a.first(), -2147483647 - 1);
+	BOOST_CHECK_EQUAL(a.second(), 2147483647);
+
+	PackedSet2<unsigned int> b(4294967295u, 0u);
+	BOOST_CHECK_EQUAL(b.first(), 0u);
+	BOOST_CHECK_EQUAL(b.second(), 4294967295u);
+
+	PackedSet2<short> c(-3, -300);
+	BOOST_CHECK_EQUAL(c.first(), -300);
+	BOOST_CHECK_EQUAL(c.second(), -3);
+}
+
+BOOST_AUTO_TEST_CASE(PackedKeyRoundTrip) {
+	PackedSet2<int> a(42, -17);
+	PackedSet2<int> b(PackedSet2<int>::fromKey(a.key()));
+	BOOST_CHECK(a == b);
+	BOOST_CHECK_EQUAL(b.first(), -17);
+	BOOST_CHECK_EQUAL(b.second(), 42);
+	BOOST_CHECK(b.unpacked() == Set2<int>(42, -17));
+	BOOST_CHECK(PackedSet2<int>(Set2<int>(42, -17)) == a);
+}
+
+BOOST_AUTO_TEST_CASE(PackedOrderMatchesCascade) {
+	std::vector<PackedSet2<int> > packed;
+	std::vector<Set2<int> > unpacked;
+	for (int i = -3; i <= 3; ++i) {
+		for (int j = -3; j <= 3; ++j) {
+			packed.push_back(PackedSet2<int>(i, j));
+			unpacked.push_back(Set2<int>(i, j));
+		}
+	}
+	std::sort(packed.begin(), packed.end());
+	std::sort(unpacked.begin(), unpacked.end());
+	for (unsigned int i = 0; i < packed.size(); ++i) {
+		BOOST_CHECK_EQUAL(packed[i].first(), unpacked[i].first());
+		BOOST_CHECK_EQUAL(packed[i].second(), unpacked[i].second());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(UnorderedSetCompatibility) {
+	boost::unordered_set<PackedSet2<int> > s;
+	s.insert(PackedSet2<int>(5, 10));
+	s.insert(PackedSet2<int>(10, 5));
+	s.insert(PackedSet2<int>(20, 30));
+
+	BOOST_CHECK_EQUAL(s.size(), 2);
+	BOOST_CHECK(s.find(PackedSet2<int>(10, 5)) != s.end());
+	BOOST_CHECK(s.find(PackedSet2<int>(5, 20)) == s.end());
+}
+
+BOOST_AUTO_TEST_CASE(UnpackedHashing) {
+	boost::unordered_set<Set2<std::string> > s;
+	s.insert(Set2<std::string>("a", "b"));
+	s.insert(Set2<std::string>("b", "a"));
+
+	BOOST_CHECK_EQUAL(s.size(), 1);
+	BOOST_CHECK(s.find(Set2<std::string>("b", "a")) != s.end());
+
+	boost::unordered_set<Set2<int> > ints;
+	ints.insert(Set2<int>(5, 10));
+	ints.insert(Set2<int>(10, 5));
+	BOOST_CHECK_EQUAL(ints.size(), 1);
+}
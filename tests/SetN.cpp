@@ -0,0 +1,146 @@
+/** @date	2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE SetN tests
+
+// Internal Includes
+#include <util/SetN.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <boost/unordered_set.hpp>
+
+// Standard includes
+#include <vector>
+#include <map>
+#include <algorithm>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+BOOST_AUTO_TEST_CASE(TriangleAllPermutations) {
+	int v[3] = {3, 1, 2};
+	std::sort(v, v + 3);
+	do {
+		SetN<int, 3, false> a(v);
+		BOOST_CHECK_EQUAL(a[0], 1);
+		BOOST_CHECK_EQUAL(a[1], 2);
+		BOOST_CHECK_EQUAL(a[2], 3);
+	} while (std::next_permutation(v, v + 3));
+}
+
+BOOST_AUTO_TEST_CASE(TetrahedronAllPermutations) {
+	double v[4] = {0.5, -1.0, 2.0, 0.25};
+	std::sort(v, v + 4);
+	do {
+		SetN<double, 4> a(v[0], v[1], v[2], v[3]);
+		BOOST_CHECK_EQUAL(a[0], -1.0);
+		BOOST_CHECK_EQUAL(a[1], 0.25);
+		BOOST_CHECK_EQUAL(a[2], 0.5);
+		BOOST_CHECK_EQUAL(a[3], 2.0);
+	} while (std::next_permutation(v, v + 4));
+}
+
+BOOST_AUTO_TEST_CASE(Duplicates) {
+	SetN<int, 4, false> a(2, 1, 2, 1);
+	BOOST_CHECK_EQUAL(a[0], 1);
+	BOOST_CHECK_EQUAL(a[1], 1);
+	BOOST_CHECK_EQUAL(a[2], 2);
+	BOOST_CHECK_EQUAL(a[3], 2);
+}
+
+BOOST_AUTO_TEST_CASE(LargerNInsertionSort) {
+	int v[6] = {5, -3, 9, 0, 2, 2};
+	SetN<int, 6> a(v);
+	std::sort(v, v + 6);
+	for (int i = 0; i < 6; ++i) {
+		BOOST_CHECK_EQUAL(a[i], v[i]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PackedShortTetrahedron) {
+	short v[4] = {-300, 7, 32767, -32768};
+	std::sort(v, v + 4);
+	do {
+		typedef SetN<short, 4> Tet;
+		Tet a(v);
+		BOOST_CHECK_EQUAL(a[0], -32768);
+		BOOST_CHECK_EQUAL(a[1], -300);
+		BOOST_CHECK_EQUAL(a[2], 7);
+		BOOST_CHECK_EQUAL(a[3], 32767);
+		BOOST_CHECK(Tet::fromKey(a.key()) == a);
+	} while (std::next_permutation(v, v + 4));
+}
+
+BOOST_AUTO_TEST_CASE(PackedOrderMatchesLexicographic) {
+	std::vector<SetN<short, 3> > packed;
+	std::vector<SetN<short, 3, false> > unpacked;
+	for (short i = -2; i <= 2; ++i) {
+		for (short j = -2; j <= 2; ++j) {
+			for (short k = -2; k <= 2; ++k) {
+				packed.push_back(SetN<short, 3>(i, j, k));
+				unpacked.push_back(SetN<short, 3, false>(i, j, k));
+			}
+		}
+	}
+	std::sort(packed.begin(), packed.end());
+	std::sort(unpacked.begin(), unpacked.end());
+	for (unsigned int n = 0; n < packed.size(); ++n) {
+		for (int i = 0; i < 3; ++i) {
+			BOOST_CHECK_EQUAL(packed[n][i], unpacked[n][i]);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(Comparison) {
+	SetN<int, 3> a(1, 2, 3);
+	SetN<int, 3> b(3, 1, 2);
+	SetN<int, 3> c(1, 2, 4);
+
+	BOOST_CHECK(a == b);
+	BOOST_CHECK(!(a < b));
+	BOOST_CHECK(!(b < a));
+	BOOST_CHECK(a < c);
+	BOOST_CHECK(!(c < a));
+	BOOST_CHECK(!(a == c));
+}
+
+BOOST_AUTO_TEST_CASE(MapCompatibility) {
+	typedef SetN<int, 3> Tri;
+	std::map<Tri, int> m;
+	m[Tri(1, 2, 3)] = 1;
+	m[Tri(2, 3, 1)] += 1;
+	m[Tri(4, 2, 3)] = 5;
+
+	BOOST_REQUIRE_EQUAL(m.size(), 2);
+	BOOST_CHECK_EQUAL(m[Tri(3, 2, 1)], 2);
+}
+
+BOOST_AUTO_TEST_CASE(UnorderedSetFaceDedup) {
+	boost::unordered_set<SetN<unsigned short, 3> > packedFaces;
+	boost::unordered_set<SetN<int, 3> > faces;
+	int tets[2][4] = {{0, 1, 2, 3}, {1, 2, 3, 4}};
+	for (int t = 0; t < 2; ++t) {
+		for (int skip = 0; skip < 4; ++skip) {
+			int f[3];
+			for (int i = 0, j = 0; i < 4; ++i) {
+				if (i != skip) {
+					f[j++] = tets[t][i];
+				}
+			}
+			faces.insert(SetN<int, 3>(f[2], f[0], f[1]));
+			packedFaces.insert(SetN<unsigned short, 3>(f[1], f[2], f[0]));
+		}
+	}
+	BOOST_CHECK_EQUAL(faces.size(), 7);
+	BOOST_CHECK_EQUAL(packedFaces.size(), 7);
+	typedef SetN<int, 3> Tri;
+	BOOST_CHECK(faces.find(Tri(3, 2, 1)) != faces.end());
+}
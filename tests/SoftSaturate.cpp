@@ -0,0 +1,179 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE SoftSaturate tests
+
+// Internal Includes
+#include <util/SoftSaturate.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+
+// Standard includes
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+namespace {
+	const double MAX_MAGNITUDE = 2.0;
+	const double KNEE = 0.5;
+
+	/// Reference shapes, using the standard library
+	struct ReferenceRational {
+		static double apply(double t) {
+			return t / (1.0 + t);
+		}
+	};
+	struct ReferenceTanh {
+		static double apply(double t) {
+			return std::tanh(t);
+		}
+	};
+	struct ReferenceExponential {
+		static double apply(double t) {
+			return 1.0 - std::exp(-t);
+		}
+	};
+
+	template<typename Reference>
+	double referenceMagnitude(double r, double knee) {
+		const double k = MAX_MAGNITUDE * knee;
+		const double span = MAX_MAGNITUDE - k;
+		return r <= k ? r : k + span * Reference::apply((r - k) / span);
+	}
+
+	/// Directions varying with i, magnitudes from 0 to 100 times the max
+	template<typename Scalar>
+	void makeSoA(std::size_t n, std::vector<Scalar> & x, std::vector<Scalar> & y, std::vector<Scalar> & z,
+	             std::vector<double> & magnitudes) {
+		for (std::size_t i = 0; i < n; ++i) {
+			const double r = 100.0 * MAX_MAGNITUDE * i / n;
+			const double theta = i * 0.37;
+			const double phi = i * 0.11;
+			x.push_back(Scalar(r * std::cos(theta) * std::sin(phi)));
+			y.push_back(Scalar(r * std::sin(theta) * std::sin(phi)));
+			z.push_back(Scalar(r * std::cos(phi)));
+			magnitudes.push_back(std::sqrt(double(x[i]) * x[i] + double(y[i]) * y[i] + double(z[i]) * z[i]));
+		}
+	}
+
+	template<typename Shape, typename Reference, typename Scalar>
+	double maxRelativeErrorSoA(double knee) {
+		const std::size_t n = 10007;
+		std::vector<Scalar> x, y, z;
+		std::vector<double> magnitudes;
+		makeSoA(n, x, y, z, magnitudes);
+		softSaturateSoA<Shape>(&x[0], &y[0], &z[0], n, Scalar(MAX_MAGNITUDE), Scalar(knee));
+		double maxError = 0;
+		for (std::size_t i = 1; i < n; ++i) {
+			const double expected = referenceMagnitude<Reference>(magnitudes[i], knee);
+			const double got = std::sqrt(double(x[i]) * x[i] + double(y[i]) * y[i] + double(z[i]) * z[i]);
+			maxError = std::max(maxError, std::fabs(got - expected) / expected);
+		}
+		return maxError;
+	}
+
+	template<typename Shape>
+	void checkSingleVector() {
+		for (double r = 0.0; r < 50.0; r += 0.25) {
+			Eigen::Vector3d vec(0.0, r * 0.6, -r * 0.8);
+			const bool result = softSaturate<Shape>(vec, MAX_MAGNITUDE, KNEE);
+			BOOST_CHECK_EQUAL(result, r > MAX_MAGNITUDE * KNEE);
+			BOOST_CHECK(vec.norm() < MAX_MAGNITUDE);
+			if (r > 0) {
+				/// Direction is preserved
+				BOOST_CHECK_CLOSE(vec[1] / vec.norm(), 0.6, 0.0001);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(BelowKneeUnchanged) {
+	const Eigen::Vector3d orig(0.3, -0.4, 0.5);
+	Eigen::Vector3d vec = orig;
+	BOOST_CHECK(!softSaturate<SoftRational>(vec, MAX_MAGNITUDE, KNEE));
+	BOOST_CHECK(!softSaturate<SoftTanh>(vec, MAX_MAGNITUDE, KNEE));
+	BOOST_CHECK(!softSaturate<SoftExponential>(vec, MAX_MAGNITUDE, KNEE));
+	BOOST_CHECK_EQUAL(vec, orig);
+
+	Eigen::Vector3d zero = Eigen::Vector3d::Zero();
+	BOOST_CHECK(!softSaturate<SoftTanh>(zero, MAX_MAGNITUDE, 0.0));
+	BOOST_CHECK_EQUAL(zero, Eigen::Vector3d::Zero());
+}
+
+BOOST_AUTO_TEST_CASE(SingleVectorBoundedAndDirectionPreserving) {
+	checkSingleVector<SoftRational>();
+	checkSingleVector<SoftTanh>();
+	checkSingleVector<SoftExponential>();
+}
+
+BOOST_AUTO_TEST_CASE(SmoothAtKnee) {
+	/// Slope 1 at the knee: just above it, magnitudes are nearly unchanged
+	const double r = MAX_MAGNITUDE * KNEE + 1e-4;
+	Eigen::Vector3d vec(r, 0.0, 0.0);
+	softSaturate<SoftExponential>(vec, MAX_MAGNITUDE, KNEE);
+	BOOST_CHECK_CLOSE(vec[0], r, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(Monotonic) {
+	/// Up to rounding, once the limited magnitude is within an ulp of the max
+	double previous = 0;
+	for (double r = 0.01; r < 100.0; r *= 1.1) {
+		Eigen::Vector2d vec(r, 0.0);
+		softSaturate<SoftTanh>(vec, MAX_MAGNITUDE, 0.0);
+		BOOST_CHECK(vec[0] >= previous * (1.0 - 1e-14));
+		previous = vec[0];
+	}
+}
+
+BOOST_AUTO_TEST_CASE(AccuracyDouble) {
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftRational, ReferenceRational, double>(KNEE)), 1e-12);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftTanh, ReferenceTanh, double>(KNEE)), 1e-12);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftExponential, ReferenceExponential, double>(KNEE)), 1e-12);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftTanh, ReferenceTanh, double>(0.0)), 1e-12);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftExponential, ReferenceExponential, double>(0.0)), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(AccuracyFloat) {
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftRational, ReferenceRational, float>(KNEE)), 2e-6);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftTanh, ReferenceTanh, float>(KNEE)), 2e-6);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftExponential, ReferenceExponential, float>(KNEE)), 2e-6);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftTanh, ReferenceTanh, float>(0.0)), 2e-6);
+	BOOST_CHECK_LT((maxRelativeErrorSoA<SoftExponential, ReferenceExponential, float>(0.0)), 2e-6);
+}
+
+BOOST_AUTO_TEST_CASE(SoAPairedMatchesAoS) {
+	const std::size_t n = 37;
+	std::vector<double> x, y, z, ox, oy, oz, magnitudes;
+	makeSoA(n, x, y, z, magnitudes);
+	makeSoA(n, ox, oy, oz, magnitudes);
+	std::vector<Eigen::Vector3d> vecs, others;
+	for (std::size_t i = 0; i < n; ++i) {
+		vecs.push_back(Eigen::Vector3d(x[i], y[i], z[i]));
+		others.push_back(Eigen::Vector3d(ox[i], oy[i], oz[i]));
+	}
+	std::vector<stdint::uint64_t> soaMask(saturateMaskWords(n));
+	std::vector<stdint::uint64_t> aosMask(saturateMaskWords(n));
+	const std::size_t soaCount = softSaturateSoA<SoftTanh>(&x[0], &y[0], &z[0], &ox[0], &oy[0], &oz[0], n,
+	                                                        MAX_MAGNITUDE, KNEE, &soaMask[0]);
+	const std::size_t aosCount = softSaturateAoS<SoftTanh>(&vecs[0], &others[0], n, MAX_MAGNITUDE, KNEE, &aosMask[0]);
+
+	BOOST_CHECK_EQUAL(soaCount, aosCount);
+	BOOST_CHECK(soaCount > 0 && soaCount < n);
+	BOOST_CHECK(soaMask == aosMask);
+	for (std::size_t i = 0; i < n; ++i) {
+		BOOST_CHECK_CLOSE(x[i] + 1.0, vecs[i][0] + 1.0, 1e-10);
+		BOOST_CHECK_CLOSE(oz[i] + 1.0, others[i][2] + 1.0, 1e-10);
+	}
+}
@@ -0,0 +1,192 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE SparseVoxelOctree
+
+// Internal Includes
+#include <util/SparseVoxelOctree.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+
+// Standard includes
+#include <vector>
+#include <map>
+#include <cstdlib>
+
+using namespace boost::unit_test;
+using namespace util;
+
+typedef SparseVoxelOctree<> Octree;
+typedef std::map<Octree::CodeType, stdint::uint32_t> ReferenceVoxels;
+
+/// Points in [-1, 5)^3, inside an octree covering [0, 4)^3
+std::vector<Eigen::Vector3d> randomPoints(std::size_t n) {
+	std::vector<Eigen::Vector3d> points;
+	for (std::size_t i = 0; i < n; ++i) {
+		points.push_back(Eigen::Vector3d(std::rand(), std::rand(), std::rand()) / RAND_MAX * 6 - Eigen::Vector3d::Ones());
+	}
+	return points;
+}
+
+ReferenceVoxels referenceVoxels(Octree const& tree, std::vector<Eigen::Vector3d> const& points) {
+	ReferenceVoxels voxels;
+	const double scale = tree.resolution() / 4.0;
+	for (std::size_t i = 0; i < points.size(); ++i) {
+		const Eigen::Vector3d p = points[i] * scale;
+		if ((p.array() >= 0).all() && (p.array() < tree.resolution()).all()) {
+			++voxels[Octree::mortonEncode(stdint::uint32_t(p[0]), stdint::uint32_t(p[1]), stdint::uint32_t(p[2]))];
+		}
+	}
+	return voxels;
+}
+
+BOOST_AUTO_TEST_CASE(MortonRoundTrip) {
+	const Octree tree(Eigen::Vector3d::Zero(), 1, Octree::MAX_DEPTH);
+	for (int i = 0; i < 1000; ++i) {
+		const stdint::uint32_t c[3] = {stdint::uint32_t(std::rand() & 0x1fffff), stdint::uint32_t(std::rand() & 0x1fffff), stdint::uint32_t(std::rand() & 0x1fffff)};
+		const Octree::CodeType code = Octree::mortonEncode(c[0], c[1], c[2]);
+		for (unsigned int axis = 0; axis < 3; ++axis) {
+			BOOST_CHECK_EQUAL(Octree::mortonDecode(code, axis), c[axis]);
+		}
+		/// Each level's child is the vertex made of that level's coordinate bits
+		for (unsigned int level = 0; level < tree.depth(); ++level) {
+			const unsigned int bit = tree.depth() - 1 - level;
+			const Octree::Vertex expected(Octree::Vertex::BitsetType(((c[0] >> bit) & 1) | ((c[1] >> bit) & 1) << 1 | ((c[2] >> bit) & 1) << 2));
+			BOOST_CHECK(tree.childVertex(code, level) == expected);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(BuildMatchesReference) {
+	const std::vector<Eigen::Vector3d> points = randomPoints(20000);
+	for (unsigned int threads = 1; threads <= 3; ++threads) {
+		Octree tree(Eigen::Vector3d::Zero(), 4, 5);
+		const ReferenceVoxels expected = referenceVoxels(tree, points);
+		std::size_t inside = 0;
+		for (ReferenceVoxels::const_iterator it = expected.begin(); it != expected.end(); ++it) {
+			inside += it->second;
+		}
+		BOOST_CHECK_EQUAL(tree.build(points, threads), inside);
+		BOOST_REQUIRE_EQUAL(tree.leafCount(), expected.size());
+		std::size_t i = 0;
+		for (ReferenceVoxels::const_iterator it = expected.begin(); it != expected.end(); ++it, ++i) {
+			BOOST_CHECK_EQUAL(tree.leafCode(i), it->first);
+			BOOST_CHECK_EQUAL(tree.leafPointCount(i), it->second);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(OccupancyQueries) {
+	const std::vector<Eigen::Vector3d> points = randomPoints(3000);
+	Octree tree(Eigen::Vector3d::Zero(), 4, 6);
+	tree.build(points);
+	const ReferenceVoxels expected = referenceVoxels(tree, points);
+	for (Octree::CodeType code = 0; code < (Octree::CodeType(1) << 18); ++code) {
+		const std::ptrdiff_t leaf = tree.findLeaf(code);
+		BOOST_REQUIRE_EQUAL(leaf >= 0, expected.count(code) == 1);
+		if (leaf >= 0) {
+			BOOST_CHECK_EQUAL(tree.leafCode(leaf), code);
+		}
+	}
+	for (std::size_t i = 0; i < points.size(); ++i) {
+		const bool inside = (points[i].array() >= 0).all() && (points[i].array() < 4).all();
+		BOOST_CHECK_EQUAL(tree.occupied(points[i]), inside);
+	}
+	BOOST_CHECK(!tree.occupied(Octree::CodeType(1) << 18));
+
+	/// Deep enough to descend below the direct lookup level
+	Octree deep(Eigen::Vector3d::Zero(), 4, 9);
+	deep.build(points);
+	const ReferenceVoxels deepExpected = referenceVoxels(deep, points);
+	for (ReferenceVoxels::const_iterator it = deepExpected.begin(); it != deepExpected.end(); ++it) {
+		BOOST_CHECK(deep.occupied(it->first));
+		BOOST_CHECK(!deep.occupied(it->first ^ 1) || deepExpected.count(it->first ^ 1));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ChildAddressing) {
+	const std::vector<Eigen::Vector3d> points = randomPoints(500);
+	Octree tree(Eigen::Vector3d::Zero(), 4, 4);
+	tree.build(points);
+	BOOST_REQUIRE(tree.nodeCount() > 0);
+	BOOST_CHECK_EQUAL(tree.levelBegin(0), 0);
+	BOOST_CHECK_EQUAL(tree.levelBegin(1), 1);
+	/// Walk down to every leaf through Cube vertices
+	for (std::size_t i = 0; i < tree.leafCount(); ++i) {
+		std::ptrdiff_t n = 0;
+		for (unsigned int level = 0; level < tree.depth(); ++level) {
+			BOOST_REQUIRE(n >= 0);
+			n = tree.child(n, tree.childVertex(tree.leafCode(i), level));
+		}
+		BOOST_CHECK_EQUAL(n, static_cast<std::ptrdiff_t>(i));
+	}
+	/// Missing children
+	for (std::size_t n = 0; n < tree.nodeCount(); ++n) {
+		for (unsigned char v = 0; v < 8; ++v) {
+			const bool exists = (tree.node(n).childMask >> v) & 1;
+			BOOST_CHECK_EQUAL(tree.child(n, Octree::Vertex(v)) >= 0, exists);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(NeighborLookup) {
+	const std::vector<Eigen::Vector3d> points = randomPoints(2000);
+	Octree tree(Eigen::Vector3d::Zero(), 4, 3);
+	tree.build(points);
+	const ReferenceVoxels expected = referenceVoxels(tree, points);
+	const int res = tree.resolution();
+	for (Octree::CodeType code = 0; code < 512; ++code) {
+		const int c[3] = {int(Octree::mortonDecode(code, 0)), int(Octree::mortonDecode(code, 1)), int(Octree::mortonDecode(code, 2))};
+		unsigned char faceMask = 0;
+		for (unsigned char f = 0; f < 6; ++f) {
+			const Octree::Face face(f);
+			int n[3] = {c[0], c[1], c[2]};
+			n[face.getFixedBitIndex()] += face.getFixedBitValue() ? 1 : -1;
+			const bool inBounds = n[face.getFixedBitIndex()] >= 0 && n[face.getFixedBitIndex()] < res;
+			Octree::CodeType neighbor;
+			BOOST_REQUIRE_EQUAL(tree.faceNeighbor(code, face, neighbor), inBounds);
+			if (inBounds) {
+				BOOST_CHECK_EQUAL(neighbor, Octree::mortonEncode(n[0], n[1], n[2]));
+				faceMask |= expected.count(neighbor) << f;
+			}
+		}
+		BOOST_CHECK_EQUAL(int(tree.faceNeighborMask(code)), int(faceMask));
+
+		unsigned char vertexMask = 0;
+		for (unsigned char v = 0; v < 8; ++v) {
+			int n[3];
+			bool inBounds = true;
+			for (int axis = 0; axis < 3; ++axis) {
+				n[axis] = c[axis] + ((v >> axis) & 1 ? 1 : -1);
+				inBounds = inBounds && n[axis] >= 0 && n[axis] < res;
+			}
+			Octree::CodeType neighbor;
+			BOOST_REQUIRE_EQUAL(tree.vertexNeighbor(code, Octree::Vertex(v), neighbor), inBounds);
+			if (inBounds) {
+				BOOST_CHECK_EQUAL(neighbor, Octree::mortonEncode(n[0], n[1], n[2]));
+				vertexMask |= expected.count(neighbor) << v;
+			}
+		}
+		BOOST_CHECK_EQUAL(int(tree.vertexNeighborMask(code)), int(vertexMask));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(EmptyAndInvalid) {
+	Octree tree(Eigen::Vector3d::Zero(), 1, 2);
+	BOOST_CHECK_EQUAL(tree.build(std::vector<Eigen::Vector3d>()), 0);
+	BOOST_CHECK_EQUAL(tree.leafCount(), 0);
+	BOOST_CHECK_EQUAL(tree.nodeCount(), 0);
+	BOOST_CHECK(!tree.occupied(Eigen::Vector3d(0.5, 0.5, 0.5)));
+
+	BOOST_CHECK_THROW(Octree(Eigen::Vector3d::Zero(), 1, 0), std::out_of_range);
+	BOOST_CHECK_THROW(Octree(Eigen::Vector3d::Zero(), 1, Octree::MAX_DEPTH + 1), std::out_of_range);
+	BOOST_CHECK_THROW(Octree(Eigen::Vector3d::Zero(), 0, 4), std::invalid_argument);
+}
@@ -0,0 +1,203 @@
+/** @date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE TrilinearInterpolation
+
+// Internal Includes
+#include <util/TrilinearInterpolation.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <Eigen/Core>
+
+// Standard includes
+#include <vector>
+#include <cstdlib>
+#include <limits>
+
+using namespace boost::unit_test;
+using namespace util;
+
+typedef Cube<> CubeType;
+typedef TrilinearGridSampler<double> ScalarSampler;
+
+double randomUnit() {
+	return double(std::rand()) / RAND_MAX;
+}
+
+/// A linear field, which trilinear interpolation reproduces
+double linearField(Eigen::Vector3d const& p) {
+	return 0.5 + 2 * p[0] - 3 * p[1] + 0.25 * p[2];
+}
+
+BOOST_AUTO_TEST_CASE(CornersMatchVertices) {
+	const CubeType::CornerMatrixType corners = CubeType::getCorners();
+	for (unsigned char v = 0; v < CubeType::Vertex::COUNT; ++v) {
+		BOOST_CHECK(corners.col(v) == CubeType::Vertex(v).get());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(WeightsAtVertices) {
+	for (unsigned char v = 0; v < CubeType::Vertex::COUNT; ++v) {
+		const Eigen::Vector3d t = (CubeType::Vertex(v).get() + Eigen::Vector3d::Ones()) / 2;
+		const Eigen::Matrix<double, 8, 1> weights = trilinearWeights(t);
+		for (int w = 0; w < 8; ++w) {
+			BOOST_CHECK_EQUAL(weights[w], w == v ? 1 : 0);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(WeightsReproducePoint) {
+	for (int i = 0; i < 100; ++i) {
+		const Eigen::Vector3d t(randomUnit(), randomUnit(), randomUnit());
+		const Eigen::Matrix<double, 8, 1> weights = trilinearWeights(t);
+		BOOST_CHECK_CLOSE(weights.sum(), 1.0, 0.0000001);
+		BOOST_CHECK((CubeType::getCorners() * weights).isApprox(2 * t - Eigen::Vector3d::Ones()));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(BatchWeightsMatchSingle) {
+	/// 37 points: exercises both full SIMD packets and the remainder
+	const int n = 37;
+	Eigen::Array<double, 3, Eigen::Dynamic, Eigen::RowMajor> t(3, n);
+	Eigen::Array<float, 3, Eigen::Dynamic, Eigen::RowMajor> tf(3, n);
+	for (int j = 0; j < n; ++j) {
+		t.col(j) << randomUnit(), randomUnit(), randomUnit();
+	}
+	tf = t.cast<float>();
+	Eigen::Array<double, 8, Eigen::Dynamic, Eigen::RowMajor> weights(8, n);
+	Eigen::Array<float, 8, Eigen::Dynamic, Eigen::RowMajor> weightsf(8, n);
+	trilinearWeights(t, weights);
+	trilinearWeights(tf, weightsf);
+	for (int j = 0; j < n; ++j) {
+		const Eigen::Vector3d point = t.col(j).matrix();
+		const Eigen::Vector3f pointf = tf.col(j).matrix();
+		BOOST_CHECK(weights.col(j).matrix().isApprox(trilinearWeights(point)));
+		BOOST_CHECK(weightsf.col(j).matrix().isApprox(trilinearWeights(pointf)));
+	}
+
+	/// Blending the corner coordinates gives back the points
+	Eigen::Array<double, 1, Eigen::Dynamic> blended(1, n);
+	const Eigen::Matrix<double, 8, 1> xs = CubeType::getCorners().row(0).transpose();
+	trilinearBlend(xs.array().replicate(1, n), weights, blended);
+	BOOST_CHECK(blended.matrix().isApprox((2 * t.row(0) - 1).matrix()));
+}
+
+BOOST_AUTO_TEST_CASE(SampleGridNodes) {
+	const Eigen::Vector3i dims(4, 3, 5);
+	std::vector<double> values(dims.prod());
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		values[i] = randomUnit();
+	}
+	const Eigen::Vector3d origin(1, -2, 0.5);
+	const Eigen::Vector3d spacing(0.5, 2, 1);
+	const ScalarSampler sampler(&values[0], dims, origin, spacing);
+	ScalarSampler::PointsType points(3, values.size());
+	for (int z = 0, i = 0; z < dims[2]; ++z) {
+		for (int y = 0; y < dims[1]; ++y) {
+			for (int x = 0; x < dims[0]; ++x, ++i) {
+				const Eigen::Vector3d p = origin + spacing.cwiseProduct(Eigen::Vector3d(x, y, z));
+				points.col(i) = p.array();
+				BOOST_CHECK_EQUAL(sampler.sample(p)[0], values[i]);
+			}
+		}
+	}
+	ScalarSampler::ValuesType sampled;
+	sampler.sample(points, sampled);
+	BOOST_REQUIRE_EQUAL(sampled.cols(), Eigen::DenseIndex(values.size()));
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		BOOST_CHECK_EQUAL(sampled(0, i), values[i]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SampleLinearField) {
+	const Eigen::Vector3i dims(6, 7, 5);
+	std::vector<double> values;
+	for (int z = 0; z < dims[2]; ++z) {
+		for (int y = 0; y < dims[1]; ++y) {
+			for (int x = 0; x < dims[0]; ++x) {
+				values.push_back(linearField(Eigen::Vector3d(x, y, z)));
+			}
+		}
+	}
+	const ScalarSampler sampler(&values[0], dims);
+	/// More than one block of points
+	const int n = 600;
+	ScalarSampler::PointsType points(3, n);
+	for (int j = 0; j < n; ++j) {
+		points.col(j) << randomUnit() * (dims[0] - 1), randomUnit() * (dims[1] - 1), randomUnit() * (dims[2] - 1);
+	}
+	ScalarSampler::ValuesType sampled;
+	sampler.sample(points, sampled);
+	for (int j = 0; j < n; ++j) {
+		const Eigen::Vector3d p = points.col(j).matrix();
+		BOOST_CHECK_CLOSE(sampled(0, j), linearField(p), 0.000001);
+		BOOST_CHECK_CLOSE(sampled(0, j), sampler.sample(p)[0], 0.000001);
+	}
+
+	/// Outside points clamp to the boundary
+	BOOST_CHECK_CLOSE(sampler.sample(Eigen::Vector3d(-3, 2, 10))[0], linearField(Eigen::Vector3d(0, 2, 4)), 0.000001);
+}
+
+BOOST_AUTO_TEST_CASE(SampleVectorField) {
+	typedef TrilinearGridSampler<float, 3> VectorSampler;
+	const Eigen::Vector3i dims(3, 3, 3);
+	std::vector<float> values;
+	for (int z = 0; z < dims[2]; ++z) {
+		for (int y = 0; y < dims[1]; ++y) {
+			for (int x = 0; x < dims[0]; ++x) {
+				/// The field is the position itself
+				values.push_back(float(x));
+				values.push_back(float(y));
+				values.push_back(float(z));
+			}
+		}
+	}
+	const VectorSampler sampler(&values[0], dims);
+	const int n = 50;
+	VectorSampler::PointsType points(3, n);
+	for (int j = 0; j < n; ++j) {
+		points.col(j) << float(randomUnit() * 2), float(randomUnit() * 2), float(randomUnit() * 2);
+	}
+	VectorSampler::ValuesType sampled;
+	sampler.sample(points, sampled);
+	for (int j = 0; j < n; ++j) {
+		const Eigen::Vector3f p = points.col(j).matrix();
+		BOOST_CHECK(sampled.col(j).matrix().isApprox(p, 0.0001f));
+		BOOST_CHECK(sampler.sample(p).isApprox(p, 0.0001f));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(NaNClampsToOrigin) {
+	const Eigen::Vector3i dims(3, 4, 2);
+	std::vector<double> values(dims.prod());
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		values[i] = randomUnit();
+	}
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	const Eigen::Vector3d origin(1, -2, 0.5);
+	const ScalarSampler sampler(&values[0], dims, origin);
+	BOOST_CHECK_EQUAL(sampler.sample(Eigen::Vector3d(nan, nan, nan))[0], values[0]);
+	/// Only the NaN coordinate goes to the origin
+	BOOST_CHECK_EQUAL(sampler.sample(Eigen::Vector3d(nan, 1, 0.5))[0], values[dims[0] * 3]);
+
+	ScalarSampler::PointsType points(3, 2);
+	points.col(0) << nan, nan, nan;
+	points.col(1) << 3, nan, 1.5;
+	ScalarSampler::ValuesType sampled;
+	sampler.sample(points, sampled);
+	BOOST_CHECK_EQUAL(sampled(0, 0), values[0]);
+	BOOST_CHECK_EQUAL(sampled(0, 1), values[dims[0] * dims[1] + 2]);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidArguments) {
+	double values[8] = {0};
+	BOOST_CHECK_THROW(ScalarSampler(NULL, Eigen::Vector3i(2, 2, 2)), std::invalid_argument);
+	BOOST_CHECK_THROW(ScalarSampler(values, Eigen::Vector3i(2, 1, 4)), std::invalid_argument);
+}
@@ -0,0 +1,89 @@
+/**
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE WithHistoryN
+
+// Internal Includes
+#include <util/WithHistoryN.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Standard includes
+#include <vector>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+namespace {
+	struct ClearKeepingCapacity {
+		void operator()(std::vector<int> & cur, std::vector<int> const& /*prev*/) const {
+			cur.clear();
+		}
+	};
+}
+
+BOOST_AUTO_TEST_CASE(DefaultConstructionPOD) {
+	WithHistoryN<int, 4> a;
+	BOOST_CHECK_EQUAL(a.depth(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(DualValueConstructionPOD) {
+	WithHistoryN<int, 4> a(5, 3);
+	BOOST_CHECK_EQUAL(a.current(), 5);
+	BOOST_CHECK_EQUAL(a.previous(), 3);
+	BOOST_CHECK_EQUAL(a.history(0), 5);
+	BOOST_CHECK_EQUAL(a.history(1), 3);
+	BOOST_CHECK_EQUAL(a.history(2), 3);
+	BOOST_CHECK_EQUAL(a.history(3), 3);
+}
+
+BOOST_AUTO_TEST_CASE(ValuePODAdvance) {
+	WithHistoryN<int, 3> a(0, 0);
+	a.current() = 1;
+	a.advance();
+	a.current() = 2;
+	a.advance();
+	a.current() = 3;
+	BOOST_CHECK_EQUAL(a.history(0), 3);
+	BOOST_CHECK_EQUAL(a.history(1), 2);
+	BOOST_CHECK_EQUAL(a.history(2), 1);
+
+	/// Oldest value comes around as the new current
+	a.advance();
+	BOOST_CHECK_EQUAL(a.current(), 1);
+	BOOST_CHECK_EQUAL(a.history(1), 3);
+	BOOST_CHECK_EQUAL(a.history(2), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ValuePODAdvanceByCopy) {
+	WithHistoryN<int, 4> a(1);
+	for (int i = 2; i <= 6; ++i) {
+		a.advanceByCopy();
+		BOOST_CHECK_EQUAL(a.current(), i - 1);
+		a.current() = i;
+	}
+	BOOST_CHECK_EQUAL(a.history(0), 6);
+	BOOST_CHECK_EQUAL(a.history(1), 5);
+	BOOST_CHECK_EQUAL(a.history(2), 4);
+	BOOST_CHECK_EQUAL(a.history(3), 3);
+}
+
+BOOST_AUTO_TEST_CASE(VectorAdvanceWithReset) {
+	WithHistoryN<std::vector<int>, 2> a(std::vector<int>(100, 1), std::vector<int>(100, 0));
+	const int * prevStorage = &a.previous()[0];
+	a.advanceWithReset(ClearKeepingCapacity());
+	BOOST_CHECK(a.current().empty());
+	BOOST_CHECK_GE(a.current().capacity(), 100u);
+	BOOST_CHECK_EQUAL(a.previous().size(), 100u);
+	BOOST_CHECK_EQUAL(a.previous()[0], 1);
+
+	a.current().assign(100, 2);
+	BOOST_CHECK_EQUAL(&a.current()[0], prevStorage);
+}
@@ -0,0 +1,171 @@
+/**
+	@date 2026
+
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE WithHistoryReuse
+
+// Internal Includes
+#include <util/WithHistory.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Standard includes
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstddef>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+namespace {
+	/// Count every allocation made by the containers under test, so that
+	/// tests can check the steady state of a history loop is allocation-free.
+	unsigned long allocationCount = 0;
+
+	template<typename T>
+	struct CountingAllocator : std::allocator<T> {
+		typedef typename std::allocator<T>::pointer pointer;
+		typedef typename std::allocator<T>::size_type size_type;
+
+		template<typename U>
+		struct rebind {
+			typedef CountingAllocator<U> other;
+		};
+
+		CountingAllocator() {}
+		CountingAllocator(CountingAllocator const& other) : std::allocator<T>(other) {}
+		template<typename U>
+		CountingAllocator(CountingAllocator<U> const& other) : std::allocator<T>(other) {}
+
+		pointer allocate(size_type n, const void * hint = 0) {
+			++allocationCount;
+			return std::allocator<T>::allocate(n, hint);
+		}
+	};
+
+	typedef std::vector<int, CountingAllocator<int> > IntVector;
+	typedef std::basic_string<char, std::char_traits<char>, CountingAllocator<char> > CountedString;
+
+	const int FRAMES = 1000;
+	const int ELEMENTS = 256;
+
+	void fill(IntVector & v, int frame) {
+		for (int i = 0; i < ELEMENTS; ++i) {
+			v.push_back(frame + i);
+		}
+	}
+
+	struct ClearKeepingCapacity {
+		void operator()(IntVector & cur, IntVector const& /*prev*/) const {
+			cur.clear();
+		}
+	};
+
+	/// Frames of a simulation loop that refills the current value each
+	/// frame, returning the number of allocations made.
+	unsigned long countAdvanceReuse(WithHistory<IntVector> & h) {
+		const unsigned long before = allocationCount;
+		for (int frame = 0; frame < FRAMES; ++frame) {
+			h.advanceReuse();
+			fill(h.current(), frame);
+		}
+		return allocationCount - before;
+	}
+
+	unsigned long countAdvanceByCopy(WithHistory<IntVector> & h) {
+		const unsigned long before = allocationCount;
+		for (int frame = 0; frame < FRAMES; ++frame) {
+			h.advanceByCopy();
+			h.current()[frame % ELEMENTS] = frame;
+		}
+		return allocationCount - before;
+	}
+
+	/// The naive alternative: assign a freshly built value each frame.
+	unsigned long countFreshAssignment(WithHistory<IntVector> & h) {
+		const unsigned long before = allocationCount;
+		for (int frame = 0; frame < FRAMES; ++frame) {
+			h.swap();
+			IntVector v;
+			fill(v, frame);
+			h.current() = v;
+		}
+		return allocationCount - before;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(AdvanceReuseClearsAndKeepsHistory) {
+	IntVector init(3, 1);
+	WithHistory<IntVector> a(init);
+	a.advanceReuse();
+	BOOST_CHECK(a.current().empty());
+	BOOST_CHECK(a.previous() == init);
+	a.current().push_back(5);
+	a.advanceReuse();
+	BOOST_CHECK(a.current().empty());
+	BOOST_REQUIRE_EQUAL(a.previous().size(), 1);
+	BOOST_CHECK_EQUAL(a.previous()[0], 5);
+}
+
+BOOST_AUTO_TEST_CASE(AdvanceWithReset) {
+	IntVector init(3, 1);
+	WithHistory<IntVector> a(init);
+	a.advanceWithReset(ClearKeepingCapacity());
+	BOOST_CHECK(a.current().empty());
+	BOOST_CHECK(a.previous() == init);
+}
+
+BOOST_AUTO_TEST_CASE(CopyPreservesOrderAfterSwap) {
+	WithHistory<int> a(5, 3);
+	a.swap();
+	WithHistory<int> b(a);
+	BOOST_CHECK_EQUAL(b.current(), 3);
+	BOOST_CHECK_EQUAL(b.previous(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(AdvanceReuseSteadyStateAllocations) {
+	WithHistory<IntVector> h;
+	/// Warm up: both buffers reach their final capacity.
+	countAdvanceReuse(h);
+	const unsigned long allocations = countAdvanceReuse(h);
+	BOOST_CHECK_EQUAL(allocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(AdvanceByCopySteadyStateAllocations) {
+	WithHistory<IntVector> h(IntVector(ELEMENTS, 0));
+	countAdvanceByCopy(h);
+	const unsigned long allocations = countAdvanceByCopy(h);
+	BOOST_CHECK_EQUAL(allocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(FreshAssignmentAllocatesEveryFrame) {
+	/// For comparison with the above: building a new value each frame
+	/// allocates at least once per frame.
+	WithHistory<IntVector> h;
+	countFreshAssignment(h);
+	const unsigned long allocations = countFreshAssignment(h);
+	BOOST_CHECK_GE(allocations, static_cast<unsigned long>(FRAMES));
+}
+
+BOOST_AUTO_TEST_CASE(AdvanceReuseStringSteadyStateAllocations) {
+	WithHistory<CountedString> h;
+	unsigned long allocations = 0;
+	for (int pass = 0; pass < 2; ++pass) {
+		const unsigned long before = allocationCount;
+		for (int frame = 0; frame < FRAMES; ++frame) {
+			h.advanceReuse();
+			h.current().append(100, static_cast<char>('a' + frame % 26));
+		}
+		allocations = allocationCount - before;
+	}
+	BOOST_CHECK_EQUAL(allocations, 0);
+}
@@ -0,0 +1,132 @@
+/**
+	@author
+	Ryan Pavlik ( <rpavlik@iastate.edu> http://academic.cleardefinition.com/ ),
+	Iowa State University
+	Virtual Reality Applications Center and
+	Human-Computer Interaction Graduate Program
+*/
+
+#define BOOST_TEST_MODULE WithTrackedHistory
+
+// Internal Includes
+#include <util/WithTrackedHistory.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Standard includes
+#include <vector>
+
+
+using namespace boost::unit_test;
+using namespace util;
+
+typedef WithTrackedHistory<std::vector<int> > History;
+
+BOOST_AUTO_TEST_CASE(ValueConstructionVector) {
+	History a(std::vector<int>(10, 1));
+	BOOST_CHECK(a.current() == std::vector<int>(10, 1));
+	BOOST_CHECK(a.previous() == std::vector<int>(10, 1));
+	BOOST_CHECK(!a.willCopyAll());
+}
+
+BOOST_AUTO_TEST_CASE(DualValueConstructionVector) {
+	History a(std::vector<int>(10, 1), std::vector<int>(10, 0));
+	BOOST_CHECK_EQUAL(a.current()[0], 1);
+	BOOST_CHECK_EQUAL(a.previous()[0], 0);
+	BOOST_CHECK(a.willCopyAll());
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == std::vector<int>(10, 1));
+	BOOST_CHECK(!a.willCopyAll());
+}
+
+BOOST_AUTO_TEST_CASE(TrackedAdvanceByCopy) {
+	History a(std::vector<int>(100, 0));
+	a.set(3, 7);
+	a.write(50) = 8;
+	BOOST_CHECK_EQUAL(a.dirtyCount(), 2u);
+	BOOST_CHECK(!a.willCopyAll());
+	BOOST_CHECK_EQUAL(a.previous()[3], 0);
+
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == a.current());
+	BOOST_CHECK_EQUAL(a.previous()[3], 7);
+	BOOST_CHECK_EQUAL(a.previous()[50], 8);
+	BOOST_CHECK_EQUAL(a.dirtyCount(), 0u);
+
+	a.set(3, 9);
+	BOOST_CHECK_EQUAL(a.previous()[3], 7);
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == a.current());
+}
+
+BOOST_AUTO_TEST_CASE(TrackedRange) {
+	History a(std::vector<int>(100, 0));
+	std::vector<int>::iterator it = a.writeRange(10, 20);
+	std::fill(it, it + 10, 5);
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == a.current());
+	BOOST_CHECK_EQUAL(a.previous()[10], 5);
+	BOOST_CHECK_EQUAL(a.previous()[19], 5);
+	BOOST_CHECK_EQUAL(a.previous()[20], 0);
+}
+
+BOOST_AUTO_TEST_CASE(ThresholdFallsBackToFullCopy) {
+	History a(std::vector<int>(100, 0));
+	a.setFullCopyThreshold(0.1);
+	for (int i = 0; i < 10; ++i) {
+		a.set(i * 10, 1);
+	}
+	BOOST_CHECK(!a.willCopyAll());
+	a.set(1, 1);
+	BOOST_CHECK(a.willCopyAll());
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == a.current());
+	BOOST_CHECK(!a.willCopyAll());
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedWritesCountOnce) {
+	History a(std::vector<int>(100, 0));
+	a.setFullCopyThreshold(0.1);
+	for (int i = 0; i < 1000; ++i) {
+		a.set(5, i);
+		a.writeRange(3, 8);
+	}
+	BOOST_CHECK_EQUAL(a.dirtyCount(), 5u);
+	BOOST_CHECK(!a.willCopyAll());
+	/// Overlapping a dirty range records only the new elements
+	a.writeRange(6, 12);
+	BOOST_CHECK_EQUAL(a.dirtyCount(), 9u);
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == a.current());
+	BOOST_CHECK_EQUAL(a.previous()[5], 999);
+
+	a.set(5, 1);
+	BOOST_CHECK_EQUAL(a.dirtyCount(), 1u);
+	a.advanceByCopy();
+	BOOST_CHECK_EQUAL(a.previous()[5], 1);
+}
+
+BOOST_AUTO_TEST_CASE(UntrackedAccessFallsBackToFullCopy) {
+	History a(std::vector<int>(10, 0));
+	a.modifyCurrent()[4] = 3;
+	BOOST_CHECK(a.willCopyAll());
+	a.advanceByCopy();
+	BOOST_CHECK_EQUAL(a.previous()[4], 3);
+
+	a.modifyCurrent().push_back(1);
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == a.current());
+}
+
+BOOST_AUTO_TEST_CASE(SwapFallsBackToFullCopy) {
+	History a(std::vector<int>(10, 1), std::vector<int>(10, 0));
+	a.advanceByCopy();
+	a.set(0, 2);
+	a.swap();
+	BOOST_CHECK_EQUAL(a.previous()[0], 2);
+	BOOST_CHECK_EQUAL(a.current()[0], 1);
+	BOOST_CHECK(a.willCopyAll());
+	a.advanceByCopy();
+	BOOST_CHECK(a.previous() == a.current());
+}
@@ -0,0 +1,280 @@
+/** @file
+	@brief Variant of WithHistory for one writer thread and any number of
+	lock-free reader threads.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_ConcurrentWithHistory_h_GUID_16fd6c41_3890_451a_96f6_31aa0d9b4ff0
+#define INCLUDED_ConcurrentWithHistory_h_GUID_16fd6c41_3890_451a_96f6_31aa0d9b4ff0
+
+// Internal Includes
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <boost/atomic.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/static_assert.hpp>
+
+// Standard includes
+// - none
+
+namespace util {
+
+/// @addtogroup DataStructures Data Structures
+/// @{
+	/** @brief Container class for a value varying over time, like
+		WithHistory, but where other threads can read the most recent two
+		"advanced" values while the owning thread keeps working.
+
+		The writer thread uses current(), previous(), swap() and
+		advanceByCopy() just as it would with WithHistory, except that
+		previous() is read-only. Each swap() or advanceByCopy() atomically
+		publishes the writer's current value as a new frame.
+
+		Reader threads call read() to get a Snapshot, which holds the two
+		most recently published frames as a consistent (current, previous)
+		pair until it is destroyed. Neither side ever takes a lock: frames
+		live in a fixed pool of Slots values, and a slot is only reused by
+		the writer once no snapshot refers to it.
+
+		Each live Snapshot pins two slots, and the writer needs one free slot
+		to advance, so choose Slots >= 3 + 2 * (maximum simultaneous
+		snapshots). If the pool is exhausted, the writer spins in swap() or
+		advanceByCopy() until a reader releases a snapshot.
+
+		@tparam T Contained type.
+		@tparam Slots Number of values in the pool, in 3 ... 256.
+	*/
+	template<typename T, int Slots = 8>
+	class ConcurrentWithHistory : boost::noncopyable {
+			BOOST_STATIC_ASSERT_MSG(Slots >= 3 && Slots <= 256, "ConcurrentWithHistory needs between 3 and 256 slots");
+
+			typedef stdint::uint64_t published_type;
+
+			struct Slot {
+				Slot() : readers(0) {}
+				T value;
+				boost::atomic<int> readers;
+			};
+
+		public:
+			/// Contained value type
+			typedef T value_type;
+
+			/// Reference to contained value type
+			typedef T & value_ref_type;
+
+			/// Reference to const contained value type
+			typedef T const& value_const_ref_type;
+
+			/// @brief A consistent pair of the two most recently published
+			/// frames, safe to use from a reader thread for as long as it exists.
+			class Snapshot {
+				public:
+					Snapshot(Snapshot const& other)
+						: _owner(other._owner)
+						, _published(other._published) {
+						_owner->_pin(_published);
+					}
+
+					Snapshot & operator=(Snapshot const& other) {
+						if (this != &other) {
+							other._owner->_pin(other._published);
+							_owner->_unpin(_published);
+							_owner = other._owner;
+							_published = other._published;
+						}
+						return *this;
+					}
+
+					~Snapshot() {
+						_owner->_unpin(_published);
+					}
+
+					/// The most recently published value at the time of read()
+					value_const_ref_type current() const {
+						return _owner->_slots[_currentIndex(_published)].value;
+					}
+
+					/// The value published before current()
+					value_const_ref_type previous() const {
+						return _owner->_slots[_previousIndex(_published)].value;
+					}
+
+					/// Number of frames published before this one: compare
+					/// to tell whether a new frame has arrived.
+					published_type frame() const {
+						return _published >> 16;
+					}
+
+				private:
+					friend class ConcurrentWithHistory;
+					/// Takes over pins already made by the caller
+					Snapshot(ConcurrentWithHistory const* owner, published_type published)
+						: _owner(owner)
+						, _published(published)
+					{}
+
+					ConcurrentWithHistory const* _owner;
+					published_type _published;
+			};
+
+			/// Default constructor: all values by default construction
+			ConcurrentWithHistory() {
+				_init();
+			}
+
+			/// Value constructor: creates current value by copy construction,
+			/// and previous value by default construction
+			explicit ConcurrentWithHistory(T const& curVal) {
+				_slots[0].value = curVal;
+				_init();
+			}
+
+			/// Value constructor: creates current and previous values
+			/// by copy construction.
+			ConcurrentWithHistory(T const& curVal, T const& prevVal) {
+				_slots[0].value = curVal;
+				_slots[1].value = prevVal;
+				_slots[2].value = prevVal;
+				_init();
+			}
+
+			/// @name Writer thread interface
+			/// @{
+
+			/// Accessor for current value - can be used as an l-value.
+			/// Not visible to readers until the next swap() or advanceByCopy().
+			value_ref_type current() {
+				return _slots[_working].value;
+			}
+
+			/// Const accessor for current value
+			value_const_ref_type current() const {
+				return _slots[_working].value;
+			}
+
+			/// Const accessor for "previous" value: this is the most recently
+			/// published value, so it may be in use by readers and can't be
+			/// modified.
+			value_const_ref_type previous() const {
+				return _slots[_currentIndex(_published.load(boost::memory_order_relaxed))].value;
+			}
+
+			/// Advance history without copying.
+			///
+			/// Publishes current() as a new frame. The new current() is a
+			/// recycled slot holding some older frame: it is your
+			/// responsibility to reinitialize it.
+			void swap() {
+				_publishWorking();
+			}
+
+			/// Advance history by copying.
+			///
+			/// Publishes current() as a new frame, and initializes the new
+			/// current() with a copy of its value.
+			void advanceByCopy() {
+				const int published = _working;
+				_publishWorking();
+				_slots[_working].value = _slots[published].value;
+			}
+
+			/// @}
+
+			/// @name Reader thread interface
+			/// @{
+
+			/// Get the two most recently published frames. Lock-free, and safe
+			/// to call from any number of threads while the writer works.
+			Snapshot read() const {
+				for (;;) {
+					const published_type p = _published.load();
+					_pin(p);
+					if (_published.load() == p) {
+						return Snapshot(this, p);
+					}
+					/// The writer moved on before our pins were visible, so it
+					/// may be reusing these slots: try again.
+					_unpin(p);
+				}
+			}
+
+			/// @}
+
+		private:
+			friend class Snapshot;
+
+			static int _currentIndex(published_type p) {
+				return static_cast<int>(p & 0xff);
+			}
+
+			static int _previousIndex(published_type p) {
+				return static_cast<int>((p >> 8) & 0xff);
+			}
+
+			static published_type _pack(published_type frame, int current, int previous) {
+				return (frame << 16) | (published_type(previous) << 8) | published_type(current);
+			}
+
+			void _init() {
+				_working = 0;
+				_published.store(_pack(0, 1, 2));
+			}
+
+			void _pin(published_type p) const {
+				_slots[_currentIndex(p)].readers.fetch_add(1);
+				_slots[_previousIndex(p)].readers.fetch_add(1);
+			}
+
+			void _unpin(published_type p) const {
+				_slots[_currentIndex(p)].readers.fetch_sub(1, boost::memory_order_release);
+				_slots[_previousIndex(p)].readers.fetch_sub(1, boost::memory_order_release);
+			}
+
+			/// Make the working slot the published current, the old published
+			/// current the published previous, and pick a new working slot.
+			void _publishWorking() {
+				const published_type old = _published.load(boost::memory_order_relaxed);
+				const int newCurrent = _working;
+				const int newPrevious = _currentIndex(old);
+				_published.store(_pack((old >> 16) + 1, newCurrent, newPrevious));
+
+				/// Any slot that is neither published nor pinned is free to write.
+				/// The seq_cst store above and loads below pair with the pin-then-
+				/// recheck in read(), so a reader either sees our new publication
+				/// or we see its pin.
+				for (int i = (newCurrent + 1) % Slots;; i = (i + 1) % Slots) {
+					if (i != newCurrent && i != newPrevious && _slots[i].readers.load() == 0) {
+						_working = i;
+						return;
+					}
+				}
+			}
+
+			mutable Slot _slots[Slots];
+			boost::atomic<published_type> _published;
+			int _working;
+	};
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_ConcurrentWithHistory_h_GUID_16fd6c41_3890_451a_96f6_31aa0d9b4ff0
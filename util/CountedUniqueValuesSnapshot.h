@@ -0,0 +1,416 @@
+/** @file
+	@brief Flat, memory-mappable on-disk snapshots of CountedUniqueValues.
+
+	A snapshot file contains a fixed header, followed by (each section
+	aligned to 8 bytes) an array of count + 1 byte offsets into the value
+	blob, an open-addressing hash index mapping values back to their IDs,
+	and the value blob itself. All of these can be used directly from a
+	read-only memory mapping, so opening a snapshot costs only the mapping
+	and one validating pass over the offsets: neither the values nor the
+	index are read.
+
+	Numbers are stored in native byte order: the header records a
+	byte-order mark and snapshots from a different-endian machine are
+	rejected when opened.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_CountedUniqueValuesSnapshot_h_GUID_3163ee27_f007_4f8c_b079_8f74af55c24c
+#define INCLUDED_CountedUniqueValuesSnapshot_h_GUID_3163ee27_f007_4f8c_b079_8f74af55c24c
+
+// Internal Includes
+#include <util/CountedUniqueValues.h>
+#include <util/ReadOnlyFileMapping.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_pod.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+// Standard includes
+#include <string>
+#include <vector>
+#include <fstream>
+#include <ostream>
+#include <cstring>
+#include <stdexcept>
+
+namespace util {
+
+	namespace detail {
+		/// @internal
+		/// @brief Fixed-size header at the start of a snapshot file.
+		struct CUVSnapshotHeader {
+			char magic[8];
+			stdint::uint32_t byteOrderMark;
+			stdint::uint32_t valueKind;
+			stdint::uint64_t valueSize;
+			stdint::uint64_t count;
+			stdint::uint64_t tableSize;
+			stdint::uint64_t offsetsStart;
+			stdint::uint64_t tableStart;
+			stdint::uint64_t valuesStart;
+			stdint::uint64_t valuesBytes;
+		};
+
+		static const char CUV_SNAPSHOT_MAGIC[8] = {'U', 'T', 'I', 'L', 'C', 'U', 'V', '1'};
+		static const stdint::uint32_t CUV_SNAPSHOT_BYTE_ORDER_MARK = 0x01020304;
+
+		/// @internal
+		/// @brief FNV-1a hash of a byte range: must stay stable across
+		/// processes and platforms since the index is stored on disk.
+		inline stdint::uint64_t cuvSnapshotHash(const char * data, std::size_t len) {
+			stdint::uint64_t h = 14695981039346656037ULL;
+			for (std::size_t i = 0; i < len; ++i) {
+				h ^= static_cast<unsigned char>(data[i]);
+				h *= 1099511628211ULL;
+			}
+			return h;
+		}
+
+		/// @internal
+		/// @brief Round up to the next multiple of 8 bytes.
+		inline stdint::uint64_t cuvSnapshotAlign(stdint::uint64_t n) {
+			return (n + 7) & ~stdint::uint64_t(7);
+		}
+
+		/// @internal
+		/// @brief Whether elements items of elementSize bytes fit between
+		/// the offsets start and end, without overflow on untrusted input.
+		inline bool cuvSnapshotSectionFits(stdint::uint64_t start, stdint::uint64_t end, stdint::uint64_t elements, stdint::uint64_t elementSize) {
+			return start <= end && elements <= (end - start) / elementSize;
+		}
+
+		/// @internal
+		/// @brief Smallest power of two with room for count values at a load factor of at most 1/2.
+		inline stdint::uint64_t cuvSnapshotTableSize(stdint::uint64_t count) {
+			stdint::uint64_t size = 1;
+			while (size < count * 2) {
+				size <<= 1;
+			}
+			return size;
+		}
+	} // end of namespace detail
+
+/// @addtogroup DataStructures Data Structures
+/// @{
+
+	/// Reference to a string stored in a mapped snapshot: no copy is made
+	/// unless you call str().
+	class SnapshotStringRef {
+		public:
+			SnapshotStringRef(const char * data, std::size_t len)
+				: _data(data)
+				, _len(len)
+			{}
+
+			const char * data() const {
+				return _data;
+			}
+
+			std::size_t size() const {
+				return _len;
+			}
+
+			/// Copy the referenced characters into a std::string
+			std::string str() const {
+				return std::string(_data, _len);
+			}
+
+			operator std::string() const {
+				return str();
+			}
+
+			bool operator==(SnapshotStringRef const& other) const {
+				return _len == other._len && std::memcmp(_data, other._data, _len) == 0;
+			}
+
+			bool operator==(std::string const& other) const {
+				return _len == other.size() && std::memcmp(_data, other.data(), _len) == 0;
+			}
+
+			bool operator==(const char * other) const {
+				return *this == SnapshotStringRef(other, std::strlen(other));
+			}
+
+			template<typename T>
+			bool operator!=(T const& other) const {
+				return !(*this == other);
+			}
+
+		private:
+			const char * _data;
+			std::size_t _len;
+	};
+
+	/// @relates SnapshotStringRef
+	inline std::ostream & operator<<(std::ostream & os, SnapshotStringRef const& s) {
+		os.write(s.data(), s.size());
+		return os;
+	}
+
+	/** @brief Describes how a value type is laid out in a snapshot.
+
+		The default handles POD types by their object representation: values
+		are hashed and compared bytewise, so avoid types with padding.
+		A specialization for std::string is provided.
+	*/
+	template<typename T>
+	struct CUVSnapshotValueTraits {
+		BOOST_STATIC_ASSERT_MSG(boost::is_pod<T>::value, "Only POD types and std::string can be stored in a snapshot.");
+		BOOST_STATIC_ASSERT_MSG(boost::alignment_of<T>::value <= 8, "Snapshot POD values are only guaranteed 8-byte alignment.");
+
+		typedef T const& const_reference;
+		static const stdint::uint32_t kind = 0;
+		static const stdint::uint64_t fixedSize = sizeof(T);
+
+		static const char * data(T const& v) {
+			return reinterpret_cast<const char *>(&v);
+		}
+
+		static std::size_t size(T const&) {
+			return sizeof(T);
+		}
+
+		static const_reference view(const char * data, std::size_t /*len*/) {
+			return *reinterpret_cast<T const *>(data);
+		}
+	};
+
+	template<>
+	struct CUVSnapshotValueTraits<std::string> {
+		typedef SnapshotStringRef const_reference;
+		static const stdint::uint32_t kind = 1;
+		static const stdint::uint64_t fixedSize = 0;
+
+		static const char * data(std::string const& v) {
+			return v.data();
+		}
+
+		static std::size_t size(std::string const& v) {
+			return v.size();
+		}
+
+		static const_reference view(const char * data, std::size_t len) {
+			return SnapshotStringRef(data, len);
+		}
+	};
+
+	/** @brief Write the values of a CountedUniqueValues container, along
+		with a prebuilt hash index, to a snapshot file that can later be
+		opened with CountedUniqueValuesSnapshot.
+
+		@throws std::runtime_error if the file could not be written.
+	*/
+	template<typename T, typename dictionary_policy>
+	void saveSnapshot(CountedUniqueValues<T, dictionary_policy> const& values, std::string const& filename) {
+		typedef CUVSnapshotValueTraits<T> traits;
+		typedef stdint::uint64_t u64;
+		const u64 n = values.size();
+
+		std::vector<u64> offsets;
+		offsets.reserve(n + 1);
+		u64 valuesBytes = 0;
+		for (u64 i = 0; i < n; ++i) {
+			offsets.push_back(valuesBytes);
+			valuesBytes += traits::size(values[i]);
+		}
+		offsets.push_back(valuesBytes);
+
+		/// Table slots hold ID + 1, so that 0 can mark an empty slot.
+		const u64 tableSize = detail::cuvSnapshotTableSize(n);
+		std::vector<u64> table(tableSize, 0);
+		for (u64 i = 0; i < n; ++i) {
+			u64 slot = detail::cuvSnapshotHash(traits::data(values[i]), traits::size(values[i])) & (tableSize - 1);
+			while (table[slot] != 0) {
+				slot = (slot + 1) & (tableSize - 1);
+			}
+			table[slot] = i + 1;
+		}
+
+		detail::CUVSnapshotHeader header;
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.magic, detail::CUV_SNAPSHOT_MAGIC, sizeof(header.magic));
+		header.byteOrderMark = detail::CUV_SNAPSHOT_BYTE_ORDER_MARK;
+		header.valueKind = traits::kind;
+		header.valueSize = traits::fixedSize;
+		header.count = n;
+		header.tableSize = tableSize;
+		header.offsetsStart = detail::cuvSnapshotAlign(sizeof(header));
+		header.tableStart = header.offsetsStart + offsets.size() * sizeof(u64);
+		header.valuesStart = header.tableStart + table.size() * sizeof(u64);
+		header.valuesBytes = valuesBytes;
+
+		std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out) {
+			throw std::runtime_error("Could not open snapshot file for writing: " + filename);
+		}
+		static const char padding[8] = {0};
+		out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+		out.write(padding, header.offsetsStart - sizeof(header));
+		out.write(reinterpret_cast<const char *>(&offsets[0]), offsets.size() * sizeof(u64));
+		out.write(reinterpret_cast<const char *>(&table[0]), table.size() * sizeof(u64));
+		for (u64 i = 0; i < n; ++i) {
+			out.write(traits::data(values[i]), traits::size(values[i]));
+		}
+		/// Pad so a zero-length value blob still maps to a valid address.
+		out.write(padding, detail::cuvSnapshotAlign(valuesBytes) - valuesBytes + 8);
+		if (!out) {
+			throw std::runtime_error("Failed writing snapshot file: " + filename);
+		}
+	}
+
+	/** @brief Read-only view of a snapshot file written by saveSnapshot(),
+		memory-mapped and queried in place.
+
+		IDs are identical to those of the CountedUniqueValues container the
+		snapshot was saved from.
+	*/
+	template<typename T>
+	class CountedUniqueValuesSnapshot : boost::noncopyable {
+		public:
+			typedef T value_type;
+			typedef CUVSnapshotValueTraits<T> traits_type;
+			typedef typename traits_type::const_reference const_reference;
+			typedef stdint::uint64_t count_type;
+
+			/// Map the given snapshot file.
+			/// @throws std::runtime_error if the file is missing, empty, or not
+			/// a compatible snapshot for this value type.
+			explicit CountedUniqueValuesSnapshot(std::string const& filename)
+				: _file(detail::openReadOnlyFile(filename, "snapshot"))
+				, _region(detail::mapReadOnlyFile(_file, filename, "snapshot")) {
+				const char * base = static_cast<const char *>(_region.get_address());
+				const std::size_t mappedSize = _region.get_size();
+				if (mappedSize < sizeof(detail::CUVSnapshotHeader)) {
+					throw std::runtime_error("File too small to be a snapshot: " + filename);
+				}
+				std::memcpy(&_header, base, sizeof(_header));
+				if (std::memcmp(_header.magic, detail::CUV_SNAPSHOT_MAGIC, sizeof(_header.magic)) != 0) {
+					throw std::runtime_error("Not a CountedUniqueValues snapshot: " + filename);
+				}
+				if (_header.byteOrderMark != detail::CUV_SNAPSHOT_BYTE_ORDER_MARK) {
+					throw std::runtime_error("Snapshot was written with a different byte order: " + filename);
+				}
+				if (_header.valueKind != traits_type::kind || _header.valueSize != traits_type::fixedSize) {
+					throw std::runtime_error("Snapshot holds a different value type: " + filename);
+				}
+				/// The header is untrusted: every section must lie inside the
+				/// mapping, in order, and aligned, and the table size must be a
+				/// power of two with at least one empty slot.
+				const count_type tableSize = _header.tableSize;
+				if (tableSize == 0 || (tableSize & (tableSize - 1)) != 0 || tableSize <= _header.count) {
+					throw std::runtime_error("Snapshot hash index is malformed: " + filename);
+				}
+				if (_header.offsetsStart < sizeof(detail::CUVSnapshotHeader)
+				        || _header.offsetsStart % 8 != 0 || _header.tableStart % 8 != 0 || _header.valuesStart % 8 != 0
+				        || _header.count == ~count_type(0)
+				        || !detail::cuvSnapshotSectionFits(_header.offsetsStart, _header.tableStart, _header.count + 1, sizeof(count_type))
+				        || !detail::cuvSnapshotSectionFits(_header.tableStart, _header.valuesStart, tableSize, sizeof(count_type))
+				        || !detail::cuvSnapshotSectionFits(_header.valuesStart, mappedSize, _header.valuesBytes, 1)) {
+					throw std::runtime_error("Snapshot file is truncated or malformed: " + filename);
+				}
+				_offsets = reinterpret_cast<const count_type *>(base + _header.offsetsStart);
+				_table = reinterpret_cast<const count_type *>(base + _header.tableStart);
+				_values = base + _header.valuesStart;
+				/// So are the offsets: each value must lie inside the blob, and
+				/// fixed-size values must be exactly their size, which keeps
+				/// every one of them aligned.
+				if (_offsets[0] != 0 || _offsets[_header.count] > _header.valuesBytes) {
+					throw std::runtime_error("Snapshot value offsets are corrupt: " + filename);
+				}
+				for (count_type i = 0; i < _header.count; ++i) {
+					const bool corrupt = traits_type::fixedSize ? _offsets[i + 1] - _offsets[i] != traits_type::fixedSize
+					                     : _offsets[i + 1] < _offsets[i];
+					if (corrupt) {
+						throw std::runtime_error("Snapshot value offsets are corrupt: " + filename);
+					}
+				}
+			}
+
+			/// Number of unique values in the snapshot
+			count_type size() const {
+				return _header.count;
+			}
+
+			/// Unchecked access to the value with ID i
+			const_reference operator[](count_type i) const {
+				return traits_type::view(_values + _offsets[i], _offsets[i + 1] - _offsets[i]);
+			}
+
+			/// Checked access to the value with ID i
+			/// @throws std::out_of_range
+			const_reference get(count_type i) const {
+				if (i >= size()) {
+					throw std::out_of_range("Snapshot value index out of range!");
+				}
+				return (*this)[i];
+			}
+
+			/// Look up the ID of a value using the stored hash index.
+			/// @returns the ID, or size() if the value is not in the snapshot.
+			count_type find(value_type const& v) const {
+				const char * data = traits_type::data(v);
+				const std::size_t len = traits_type::size(v);
+				const count_type mask = _header.tableSize - 1;
+				count_type slot = detail::cuvSnapshotHash(data, len) & mask;
+				/// Bounded so a corrupt table with no empty slot still ends
+				for (count_type probes = 0; probes < _header.tableSize && _table[slot] != 0; ++probes) {
+					const count_type id = _table[slot] - 1;
+					if (id >= size()) {
+						throw std::runtime_error("Snapshot hash index is corrupt!");
+					}
+					if (_offsets[id + 1] - _offsets[id] == len && std::memcmp(_values + _offsets[id], data, len) == 0) {
+						return id;
+					}
+					slot = (slot + 1) & mask;
+				}
+				return size();
+			}
+
+		private:
+			boost::interprocess::file_mapping _file;
+			boost::interprocess::mapped_region _region;
+			detail::CUVSnapshotHeader _header;
+			const count_type * _offsets;
+			const count_type * _table;
+			const char * _values;
+	};
+
+	/// @brief Re-intern every value of a snapshot file into a CountedUniqueValues
+	/// container, for when you need to keep storing new values.
+	///
+	/// If dest is empty beforehand, IDs match those in the snapshot.
+	template<typename T, typename dictionary_policy>
+	void loadSnapshot(std::string const& filename, CountedUniqueValues<T, dictionary_policy> & dest) {
+		CountedUniqueValuesSnapshot<T> snapshot(filename);
+		for (typename CountedUniqueValuesSnapshot<T>::count_type i = 0; i < snapshot.size(); ++i) {
+			dest.store(T(snapshot[i]));
+		}
+	}
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_CountedUniqueValuesSnapshot_h_GUID_3163ee27_f007_4f8c_b079_8f74af55c24c
@@ -1,6 +1,10 @@
 /** @file
 	@brief Header
 
+	Topology queries (neighbors, face vertices, incidence) are answered
+	from the constant lookup tables in CubeTables. Each component class
+	also has a one-byte Packed counterpart for dense arrays of IDs.
+
 	@versioninfo@
 
 	@date 2011
@@ -32,7 +36,7 @@
 #include <bitset>
 #include <cassert>
 #include <stdexcept>
-#include <iosfwd>
+#include <ostream>
 
 namespace util {
 
@@ -83,16 +87,356 @@ namespace util {
 			}
 		} // end of namespace detail
 
+		/** @brief Precomputed topology of a cube, as constant lookup tables
+			indexed by the vertex, face and edge IDs used by Cube.
+
+			Vertex IDs are the 3-bit values described in Cube::Vertex and face
+			IDs those of Cube::Face. Edge e runs along axis e / 4, between the
+			two vertices whose other two bits (in increasing bit order) form the
+			2-bit value e % 4: the same packing FaceVertex uses within a face.
+
+			These are plain static arrays, so inner loops over many cells can
+			index them directly instead of constructing components.
+		*/
+		template<typename Dummy = void>
+		struct CubeTablesT {
+			/// vertexNeighbors[v][m]: neighbor of vertex v differing in bit m
+			static const unsigned char vertexNeighbors[8][3];
+			/// vertexEdges[v][m]: edge along axis m touching vertex v
+			static const unsigned char vertexEdges[8][3];
+			/// vertexFaces[v][m]: face with fixed bit m that contains vertex v
+			static const unsigned char vertexFaces[8][3];
+			/// faceVertices[f][k]: face vertex k of face f, as a cube vertex ID
+			static const unsigned char faceVertices[6][4];
+			/// faceEdges[f][i]: edges of face f in order around the face,
+			/// starting from face vertex 0 towards face vertex 1
+			static const unsigned char faceEdges[6][4];
+			/// edgeVertices[e]: the two ends of edge e, lower ID first
+			static const unsigned char edgeVertices[12][2];
+			/// edgeFaces[e]: the two faces sharing edge e, lower ID first
+			static const unsigned char edgeFaces[12][2];
+		};
+
+		template<typename Dummy>
+		const unsigned char CubeTablesT<Dummy>::vertexNeighbors[8][3] = {
+			{1, 2, 4}, {0, 3, 5}, {3, 0, 6}, {2, 1, 7}, {5, 6, 0}, {4, 7, 1}, {7, 4, 2}, {6, 5, 3}
+		};
+
+		template<typename Dummy>
+		const unsigned char CubeTablesT<Dummy>::vertexEdges[8][3] = {
+			{0, 4, 8}, {0, 5, 9}, {1, 4, 10}, {1, 5, 11}, {2, 6, 8}, {2, 7, 9}, {3, 6, 10}, {3, 7, 11}
+		};
+
+		template<typename Dummy>
+		const unsigned char CubeTablesT<Dummy>::vertexFaces[8][3] = {
+			{0, 1, 2}, {3, 1, 2}, {0, 4, 2}, {3, 4, 2}, {0, 1, 5}, {3, 1, 5}, {0, 4, 5}, {3, 4, 5}
+		};
+
+		template<typename Dummy>
+		const unsigned char CubeTablesT<Dummy>::faceVertices[6][4] = {
+			{0, 2, 4, 6}, {0, 1, 4, 5}, {0, 1, 2, 3}, {1, 3, 5, 7}, {2, 3, 6, 7}, {4, 5, 6, 7}
+		};
+
+		template<typename Dummy>
+		const unsigned char CubeTablesT<Dummy>::faceEdges[6][4] = {
+			{4, 10, 6, 8}, {0, 9, 2, 8}, {0, 5, 1, 4}, {5, 11, 7, 9}, {1, 11, 3, 10}, {2, 7, 3, 6}
+		};
+
+		template<typename Dummy>
+		const unsigned char CubeTablesT<Dummy>::edgeVertices[12][2] = {
+			{0, 1}, {2, 3}, {4, 5}, {6, 7}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}
+		};
+
+		template<typename Dummy>
+		const unsigned char CubeTablesT<Dummy>::edgeFaces[12][2] = {
+			{1, 2}, {2, 4}, {1, 5}, {4, 5}, {0, 2}, {2, 3}, {0, 5}, {3, 5}, {0, 1}, {1, 3}, {0, 4}, {3, 4}
+		};
+
+		/// The cube topology tables
+		typedef CubeTablesT<> CubeTables;
+
+		/** @name Packed components
+			@brief One-byte, trivially-copyable counterparts of the Cube
+			component classes, holding just the component ID.
+
+			They have no virtual functions, so arrays of them are plain
+			arrays of IDs that can be stored densely (or reinterpreted as
+			unsigned char for SIMD code). They convert to and from the
+			corresponding Cube classes, and are streamed by free functions.
+		*/
+		/// @{
+
+		/// @brief A cube vertex: the 3-bit ID of Cube::Vertex
+		class PackedVertex {
+			public:
+				static const unsigned char COUNT = 8;
+
+				/// Default constructor: vertex 0
+				PackedVertex()
+					: _id(0)
+				{}
+
+				/// Constructor from a vertex ID in range 0, 1, ..., 7
+				explicit PackedVertex(unsigned char v)
+					: _id(v) {
+					if (v >= COUNT) {
+						throw std::out_of_range("Vertex index specified is out of range  {0, 1, ..., 7} !");
+					}
+				}
+
+				unsigned char getID() const {
+					return _id;
+				}
+
+				/// Get the value of bit (axis) m, where m is in 0, 1, 2
+				bool getBit(unsigned char m) const {
+					assert(m < 3);
+					return (_id >> m) & 1;
+				}
+
+				/// Get vertex neighbor m, where m is in 0, 1, 2
+				PackedVertex getNeighbor(unsigned char m) const {
+					assert(m < 3);
+					return PackedVertex(CubeTables::vertexNeighbors[_id][m]);
+				}
+
+				bool operator==(PackedVertex const& other) const {
+					return _id == other._id;
+				}
+
+				bool operator!=(PackedVertex const& other) const {
+					return _id != other._id;
+				}
+
+			private:
+				unsigned char _id;
+		};
+
+		/// @brief A cube face: the ID of Cube::Face
+		class PackedFace {
+			public:
+				static const unsigned char COUNT = 6;
+
+				/// Default constructor: face 0
+				PackedFace()
+					: _id(0)
+				{}
+
+				/// Constructor from a face ID in range 0, 1, ..., 5
+				explicit PackedFace(unsigned char f)
+					: _id(f) {
+					if (f >= COUNT) {
+						throw std::out_of_range("Face index specified is out of range {0, 1, ..., 5} !");
+					}
+				}
+
+				unsigned char getID() const {
+					return _id;
+				}
+
+				/// Get the ID of the bit that is fixed for this face
+				unsigned char getFixedBitIndex() const {
+					return _id % 3;
+				}
+
+				/// Get the value assigned to the fixed bit for this face
+				bool getFixedBitValue() const {
+					return _id >= 3;
+				}
+
+				bool operator==(PackedFace const& other) const {
+					return _id == other._id;
+				}
+
+				bool operator!=(PackedFace const& other) const {
+					return _id != other._id;
+				}
+
+			private:
+				unsigned char _id;
+		};
+
+		/// @brief A vertex of a cube face: face ID * 4 + face vertex ID
+		class PackedFaceVertex {
+			public:
+				/// Default constructor: face vertex 0 of face 0
+				PackedFaceVertex()
+					: _id(0)
+				{}
+
+				/// Constructor from a face and an ID in {0, 1, 2, 3}
+				PackedFaceVertex(PackedFace f, unsigned char k)
+					: _id(f.getID() * 4 + k) {
+					if (k >= 4) {
+						throw std::out_of_range("Face vertex index specified is out of range {0, 1, 2, 3} !");
+					}
+				}
+
+				/// Get the face this vertex belongs to
+				PackedFace getFace() const {
+					return PackedFace(_id / 4);
+				}
+
+				/// Get the ID in {0, 1, 2, 3}
+				unsigned char getID() const {
+					return _id % 4;
+				}
+
+				/// Get the corresponding cube vertex
+				PackedVertex getCubeVertex() const {
+					return PackedVertex(CubeTables::faceVertices[_id / 4][_id % 4]);
+				}
+
+				bool operator==(PackedFaceVertex const& other) const {
+					return _id == other._id;
+				}
+
+				bool operator!=(PackedFaceVertex const& other) const {
+					return _id != other._id;
+				}
+
+			private:
+				unsigned char _id;
+		};
+
+		/// @brief A cube edge: the ID of Cube::Edge
+		class PackedEdge {
+			public:
+				static const unsigned char COUNT = 12;
+
+				/// Default constructor: edge 0
+				PackedEdge()
+					: _id(0)
+				{}
+
+				/// Constructor from an edge ID in range 0, 1, ..., 11
+				explicit PackedEdge(unsigned char e)
+					: _id(e) {
+					if (e >= COUNT) {
+						throw std::out_of_range("Edge index specified is out of range {0, 1, ..., 11} !");
+					}
+				}
+
+				unsigned char getID() const {
+					return _id;
+				}
+
+				/// Get the index of the bit (axis) that varies along this edge
+				unsigned char getAxis() const {
+					return _id / 4;
+				}
+
+				/// Get one of the ends of this edge, with n in 0, 1 (lower ID first)
+				PackedVertex getVertex(unsigned char n) const {
+					assert(n < 2);
+					return PackedVertex(CubeTables::edgeVertices[_id][n]);
+				}
+
+				bool operator==(PackedEdge const& other) const {
+					return _id == other._id;
+				}
+
+				bool operator!=(PackedEdge const& other) const {
+					return _id != other._id;
+				}
+
+			private:
+				unsigned char _id;
+		};
+
+		/// @brief An edge of a cube face: face ID * 4 + face edge ID
+		class PackedFaceEdge {
+			public:
+				/// Default constructor: face edge 0 of face 0
+				PackedFaceEdge()
+					: _id(0)
+				{}
+
+				/// Constructor from a face and an ID in {0, 1, 2, 3}
+				PackedFaceEdge(PackedFace f, unsigned char i)
+					: _id(f.getID() * 4 + i) {
+					if (i >= 4) {
+						throw std::out_of_range("Face edge index specified is out of range {0, 1, 2, 3} !");
+					}
+				}
+
+				/// Get the face this edge belongs to
+				PackedFace getFace() const {
+					return PackedFace(_id / 4);
+				}
+
+				/// Get the ID in {0, 1, 2, 3}
+				unsigned char getID() const {
+					return _id % 4;
+				}
+
+				/// Get the corresponding cube edge
+				PackedEdge getCubeEdge() const {
+					return PackedEdge(CubeTables::faceEdges[_id / 4][_id % 4]);
+				}
+
+				bool operator==(PackedFaceEdge const& other) const {
+					return _id == other._id;
+				}
+
+				bool operator!=(PackedFaceEdge const& other) const {
+					return _id != other._id;
+				}
+
+			private:
+				unsigned char _id;
+		};
+
+		inline std::ostream & operator<<(std::ostream & os, PackedVertex const& v) {
+			return os << "Vertex " << int(v.getID());
+		}
+
+		inline std::ostream & operator<<(std::ostream & os, PackedFace const& f) {
+			return os << "Face " << int(f.getID());
+		}
+
+		inline std::ostream & operator<<(std::ostream & os, PackedFaceVertex const& fv) {
+			return os << "Face vertex " << int(fv.getID()) << " on face " << int(fv.getFace().getID());
+		}
+
+		inline std::ostream & operator<<(std::ostream & os, PackedEdge const& e) {
+			return os << "Edge " << int(e.getID());
+		}
+
+		inline std::ostream & operator<<(std::ostream & os, PackedFaceEdge const& fe) {
+			return os << "Face edge " << int(fe.getID()) << " on face " << int(fe.getFace().getID());
+		}
+		/// @}
+
 		template<typename _VecType = Eigen::Vector3d>
 		struct Cube {
 				typedef unsigned char BitIDType;
 				typedef unsigned char IDType;
 				typedef bool BitValueType;
 				typedef _VecType VectorType;
+				typedef CubeTables Tables;
+				typedef CubeComponents::PackedVertex PackedVertex;
+				typedef CubeComponents::PackedFace PackedFace;
+				typedef CubeComponents::PackedFaceVertex PackedFaceVertex;
+				typedef CubeComponents::PackedEdge PackedEdge;
+				typedef CubeComponents::PackedFaceEdge PackedFaceEdge;
+				typedef Eigen::Matrix<typename VectorType::Scalar, 3, 8> CornerMatrixType;
+
+				/// @brief Get the coordinates of all 8 vertices at once: column v
+				/// is Vertex(v).get().
+				static CornerMatrixType getCorners() {
+					CornerMatrixType corners;
+					corners << -1, 1, -1, 1, -1, 1, -1, 1,
+					        -1, -1, 1, 1, -1, -1, 1, 1,
+					        -1, -1, -1, -1, 1, 1, 1, 1;
+					return corners;
+				}
 
 				class Vertex;
 				class Face;
 				class FaceVertex;
+				class FaceEdge;
+				class Edge;
 
 				/** @brief Representation of a vertex of a 2x2x2 cube centered at the origin
 
@@ -123,6 +467,16 @@ namespace util {
 							}
 						}
 
+						/// Constructor from the packed representation
+						Vertex(PackedVertex const& v)
+							: _v(v.getID())
+						{}
+
+						/// Get the packed (one byte) representation
+						PackedVertex pack() const {
+							return PackedVertex(getID());
+						}
+
 						/// Get the coordinates of this vertex in a 2x2x2 cube centered
 						/// on the origin. (All components will be +-1)
 						VectorType get() const {
@@ -140,9 +494,30 @@ namespace util {
 						}
 
 						/// Get vertex neighbor m, where m is in 0, 1, 2
-						Vertex getNeighbor(IDType m) {
+						Vertex getNeighbor(IDType m) const {
 							assert(m < 3);
-							return Vertex(BitsetType(_v).flip(m));
+							return Vertex(BitsetType(Tables::vertexNeighbors[getID()][m]));
+						}
+
+						/// Get the IDs of all three neighbors, indexed like getNeighbor()
+						IDType const (&getNeighborIDs() const)[3] {
+							return Tables::vertexNeighbors[getID()];
+						}
+
+						/// Get the face containing this vertex whose fixed bit is m, where m is in 0, 1, 2
+						Face getFace(IDType m) const {
+							assert(m < 3);
+							return Face(Tables::vertexFaces[getID()][m]);
+						}
+
+						/// Get the IDs of the three faces containing this vertex, indexed like getFace()
+						IDType const (&getFaceIDs() const)[3] {
+							return Tables::vertexFaces[getID()];
+						}
+
+						/// Get the IDs of the three edges touching this vertex, indexed by axis
+						IDType const (&getEdgeIDs() const)[3] {
+							return Tables::vertexEdges[getID()];
 						}
 
 						/// Compare vertex equality based on ID
@@ -158,7 +533,7 @@ namespace util {
 
 					private:
 						void streamTo(std::ostream & os) const {
-							os << "Vertex " << getID();
+							os << "Vertex " << int(getID());
 						}
 
 						BitsetType _v;
@@ -196,6 +571,17 @@ namespace util {
 							}
 						}
 
+						/// Constructor from the packed representation
+						Face(PackedFace const& f)
+							: _fixedBit(f.getFixedBitIndex())
+							, _bitval(f.getFixedBitValue())
+						{}
+
+						/// Get the packed (one byte) representation
+						PackedFace pack() const {
+							return PackedFace(getID());
+						}
+
 						/// Get coordinates of the center of this face
 						VectorType getCenter() const {
 							return VectorType(_fixedBit == 0 ? _bitval * 2 - 1 : 0,
@@ -224,10 +610,20 @@ namespace util {
 						}
 
 						/// Get one of the vertices of this face, with id in 0, 1, 2, 3
-						FaceVertex getFaceVertex(IDType k) {
+						FaceVertex getFaceVertex(IDType k) const {
 							return FaceVertex(*this, k);
 						}
 
+						/// Get the cube vertex IDs of this face's vertices, indexed by face vertex ID
+						IDType const (&getVertexIDs() const)[4] {
+							return Tables::faceVertices[getID()];
+						}
+
+						/// Get the IDs of this face's edges, in order around the face
+						IDType const (&getEdgeIDs() const)[4] {
+							return Tables::faceEdges[getID()];
+						}
+
 						/// Comparison operator based on face ID
 						bool operator==(Face const& other) const {
 							return getID() == other.getID();
@@ -237,7 +633,7 @@ namespace util {
 						/// Method to insert a human-readable description
 						/// into a std::ostream
 						void streamTo(std::ostream & os) const {
-							os << "Face " << getID();
+							os << "Face " << int(getID());
 						}
 
 						BitIDType _fixedBit;
@@ -265,6 +661,18 @@ namespace util {
 							}
 						}
 
+						/// Constructor from the packed representation
+						FaceVertex(PackedFaceVertex const& fv)
+							: _fixedBit(fv.getFace().getFixedBitIndex())
+							, _bitval(fv.getFace().getFixedBitValue())
+							, _vertexID(fv.getID())
+						{}
+
+						/// Get the packed (one byte) representation
+						PackedFaceVertex pack() const {
+							return PackedFaceVertex(getFace().pack(), _vertexID);
+						}
+
 						/// Get the face this vertex belongs to
 						Face getFace() const {
 							return Face(_fixedBit, _bitval);
@@ -285,7 +693,7 @@ namespace util {
 
 						/// Conversion operator to (Cube) Vertex
 						operator Vertex() const {
-							return Vertex(detail::bitsetInsert(BitsetType(_vertexID), _bitval, _fixedBit));
+							return Vertex(typename Vertex::BitsetType(Tables::faceVertices[_bitval * 3 + _fixedBit][_vertexID]));
 						}
 
 						/// Explicit method for converting to cube Vertex
@@ -298,19 +706,203 @@ namespace util {
 						/// Method to insert a human-readable description
 						/// into a std::ostream
 						void streamTo(std::ostream & os) const {
-							os << "Face vertex " << _vertexID << " on face " << getFace().getID();
+							os << "Face vertex " << int(_vertexID) << " on face " << int(getFace().getID());
 						}
 
 						BitIDType _fixedBit;
 						BitValueType _bitval;
 						IDType _vertexID;
 				};
-				struct FaceEdge;
-				struct Edge;
+
+				/** @brief Representation of an edge of a 2x2x2 cube centered at the origin.
+
+					An edge joins two vertices that differ in a single bit, its
+					axis. Edge IDs follow CubeTables: edge e is along axis e / 4,
+					and e % 4 packs the values of the other two bits.
+				*/
+				class Edge : public detail::Outputable {
+					public:
+						static const IDType COUNT = 12;
+
+						/// Default constructor: constructs edge 0
+						Edge()
+							: _id(0)
+						{}
+
+						/// Constructor from an edge ID in range 0, 1, ..., 11
+						explicit Edge(IDType e)
+							: _id(e) {
+							if (e >= COUNT) {
+								throw std::out_of_range("Edge index specified is out of range {0, 1, ..., 11} !");
+							}
+						}
+
+						/// Constructor from the two (neighboring) vertices it joins
+						Edge(Vertex const& a, Vertex const& b)
+							: _id(0) {
+							const IDType diff = a.getID() ^ b.getID();
+							if (diff != 1 && diff != 2 && diff != 4) {
+								throw std::invalid_argument("Vertices specified for an edge are not neighbors!");
+							}
+							_id = Tables::vertexEdges[a.getID()][diff >> 1];
+						}
+
+						/// Constructor from the packed representation
+						Edge(PackedEdge const& e)
+							: _id(e.getID())
+						{}
+
+						/// Get the packed (one byte) representation
+						PackedEdge pack() const {
+							return PackedEdge(_id);
+						}
+
+						/// Get edge ID in range 0, 1, ..., 11
+						IDType getID() const {
+							return _id;
+						}
+
+						/// Get the index of the bit (axis) that varies along this edge
+						BitIDType getAxis() const {
+							return _id / 4;
+						}
+
+						/// Get one of the ends of this edge, with n in 0, 1 (lower ID first)
+						Vertex getVertex(IDType n) const {
+							assert(n < 2);
+							return Vertex(typename Vertex::BitsetType(Tables::edgeVertices[_id][n]));
+						}
+
+						/// Get the IDs of both ends of this edge, indexed like getVertex()
+						IDType const (&getVertexIDs() const)[2] {
+							return Tables::edgeVertices[_id];
+						}
+
+						/// Get one of the two faces sharing this edge, with n in 0, 1 (lower ID first)
+						Face getFace(IDType n) const {
+							assert(n < 2);
+							return Face(Tables::edgeFaces[_id][n]);
+						}
+
+						/// Get the IDs of both faces sharing this edge, indexed like getFace()
+						IDType const (&getFaceIDs() const)[2] {
+							return Tables::edgeFaces[_id];
+						}
+
+						/// Get coordinates of the midpoint of this edge
+						VectorType getCenter() const {
+							return (getVertex(0).get() + getVertex(1).get()) / 2;
+						}
+
+						/// Compare edge equality based on ID
+						bool operator==(Edge const& other) const {
+							return _id == other._id;
+						}
+
+						/// Compare edge inequality based on ID
+						bool operator!=(Edge const& other) const {
+							return _id != other._id;
+						}
+
+					private:
+						/// Method to insert a human-readable description
+						/// into a std::ostream
+						void streamTo(std::ostream & os) const {
+							os << "Edge " << int(_id);
+						}
+
+						IDType _id;
+				};
+
+				/** @brief Representation of an edge of a cube face.
+
+					Face edges are numbered 0, 1, 2, 3 in order around the face,
+					as in CubeTables::faceEdges: face edge 0 runs from face vertex 0
+					to face vertex 1, and each face edge shares its second face
+					vertex with the next one. Convertible to a cube Edge.
+				*/
+				class FaceEdge : public detail::Outputable {
+					public:
+						static const IDType COUNT = 4;
+
+						/// Constructor from a face and an ID in {0, 1, 2, 3}
+						FaceEdge(Face const& f, IDType i)
+							: _faceID(f.getID())
+							, _edgeID(i) {
+							if (i >= COUNT) {
+								throw std::out_of_range("Face edge index specified is out of range {0, 1, 2, 3} !");
+							}
+						}
+
+						/// Constructor from the packed representation
+						FaceEdge(PackedFaceEdge const& fe)
+							: _faceID(fe.getFace().getID())
+							, _edgeID(fe.getID())
+						{}
+
+						/// Get the packed (one byte) representation
+						PackedFaceEdge pack() const {
+							return PackedFaceEdge(PackedFace(_faceID), _edgeID);
+						}
+
+						/// Get the face this edge belongs to
+						Face getFace() const {
+							return Face(_faceID);
+						}
+
+						/// Get the ID in {0, 1, 2, 3}
+						IDType getID() const {
+							return _edgeID;
+						}
+
+						/// Get the adjacent edge on this face: n = 0 for the
+						/// previous one around the face, n = 1 for the next one
+						FaceEdge getNeighbor(IDType n) const {
+							if (n >= 2) {
+								throw std::out_of_range("Face edge neighbor index specified is out of range {0, 1} !");
+							}
+							return FaceEdge(getFace(), (_edgeID + (n ? 1 : 3)) % COUNT);
+						}
+
+						/// Get one of the ends of this edge as a face vertex:
+						/// n = 0 for where it starts around the face, n = 1 for where it ends
+						FaceVertex getFaceVertex(IDType n) const {
+							assert(n < 2);
+							/// Face vertices in order around the face
+							static const IDType around[4] = {0, 1, 3, 2};
+							return FaceVertex(getFace(), around[(_edgeID + n) % COUNT]);
+						}
+
+						/// Conversion operator to (Cube) Edge
+						operator Edge() const {
+							return Edge(Tables::faceEdges[_faceID][_edgeID]);
+						}
+
+						/// Explicit method for converting to cube Edge
+						Edge getCubeEdge() const {
+							return operator Edge();
+						}
+
+						/// Compare face edge equality based on face and ID
+						bool operator==(FaceEdge const& other) const {
+							return _faceID == other._faceID && _edgeID == other._edgeID;
+						}
+
+					private:
+						/// Method to insert a human-readable description
+						/// into a std::ostream
+						void streamTo(std::ostream & os) const {
+							os << "Face edge " << int(_edgeID) << " on face " << int(_faceID);
+						}
+
+						IDType _faceID;
+						IDType _edgeID;
+				};
 		}; // end of class Cube
 	} // end of namespace CubeComponents
 
 	using CubeComponents::Cube;
+	using CubeComponents::CubeTables;
 
 } // end of namespace util
 
@@ -0,0 +1,391 @@
+/** @file
+	@brief Compact little-endian binary reading and writing of Eigen
+	matrices, without the per-element overhead of Boost.Serialization.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_EigenBinaryIO_h_GUID_6a21f714_dbdd_4873_b187_f82f2a19540b
+#define INCLUDED_EigenBinaryIO_h_GUID_6a21f714_dbdd_4873_b187_f82f2a19540b
+
+// Internal Includes
+#include <util/ReceiveBuffer.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+
+// Standard includes
+#include <cstring>
+#include <cstddef>
+#include <cerrno>
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+#include <vector>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace util {
+
+	namespace detail {
+		/// @internal
+		/// @brief Type of the dimensions written for dynamic-size matrices
+		typedef stdint::uint64_t binary_dim_type;
+
+		/// @internal
+		/// @brief Whether this machine stores values little-endian: folded
+		/// to a constant by the compiler.
+		inline bool binaryHostIsLittleEndian() {
+			const stdint::uint16_t one = 1;
+			unsigned char firstByte;
+			std::memcpy(&firstByte, &one, 1);
+			return firstByte == 1;
+		}
+
+		/// @internal
+		/// @brief Copy count elements of elementSize bytes each between host
+		/// and little-endian byte order (the conversion is its own inverse):
+		/// a single memcpy on little-endian machines. dest may equal src to
+		/// convert in place, but the ranges must not otherwise overlap.
+		inline void binaryCopyLittleEndian(void * dest, void const* src, std::size_t count, std::size_t elementSize) {
+			if (binaryHostIsLittleEndian() || elementSize == 1) {
+				if (dest != src) {
+					std::memcpy(dest, src, count * elementSize);
+				}
+				return;
+			}
+			unsigned char * d = static_cast<unsigned char *>(dest);
+			unsigned char const* s = static_cast<unsigned char const*>(src);
+			for (std::size_t i = 0; i < count; ++i, d += elementSize, s += elementSize) {
+				if (dest == src) {
+					std::reverse(d, d + elementSize);
+				} else {
+					std::reverse_copy(s, s + elementSize, d);
+				}
+			}
+		}
+
+		/// @internal
+		/// @brief Layout of the binary form of a plain matrix or array type.
+		template<typename Derived>
+		struct EigenBinaryLayout {
+			typedef typename Derived::Scalar Scalar;
+			BOOST_STATIC_ASSERT_MSG(boost::is_arithmetic<Scalar>::value, "Binary matrix IO supports arithmetic scalar types only");
+			enum {
+				DynamicRows = (Derived::RowsAtCompileTime == Eigen::Dynamic) ? 1 : 0,
+				DynamicCols = (Derived::ColsAtCompileTime == Eigen::Dynamic) ? 1 : 0,
+				HeaderBytes = (DynamicRows + DynamicCols) * sizeof(binary_dim_type)
+			};
+		};
+
+		/// @internal
+		/// @brief Size in bytes of the binary form of a rows x cols matrix,
+		/// checked before anything is allocated since the dimensions come
+		/// from untrusted input.
+		/// @throws std::runtime_error if the matrix could not be indexed,
+		/// or its size in bytes would overflow std::size_t.
+		template<typename Derived>
+		inline std::size_t binaryCheckedSize(binary_dim_type rows, binary_dim_type cols) {
+			typedef EigenBinaryLayout<Derived> layout;
+			const binary_dim_type maxIndex = Eigen::NumTraits<typename Derived::Index>::highest();
+			const binary_dim_type maxBytes = std::numeric_limits<std::size_t>::max() - layout::HeaderBytes;
+			const binary_dim_type maxSize = std::min(maxIndex, maxBytes / sizeof(typename layout::Scalar));
+			if (rows > maxIndex || cols > maxIndex || (rows != 0 && cols > maxSize / rows)) {
+				throw std::runtime_error("Matrix dimensions in binary data are too large");
+			}
+			return layout::HeaderBytes + std::size_t(rows * cols) * sizeof(typename layout::Scalar);
+		}
+
+		/// @internal
+		/// @brief Write all of buf to a file descriptor, retrying short writes.
+		inline void binaryWriteAll(int fd, void const* buf, std::size_t len) {
+			char const* p = static_cast<char const*>(buf);
+			while (len > 0) {
+#if defined(_WIN32)
+				const int ret = ::_write(fd, p, static_cast<unsigned int>(len));
+#else
+				const ssize_t ret = ::write(fd, p, len);
+#endif
+				if (ret < 0) {
+					if (errno == EINTR) {
+						continue;
+					}
+					throw std::runtime_error("Failed writing matrix data to file descriptor");
+				}
+				p += ret;
+				len -= ret;
+			}
+		}
+
+		/// @internal
+		/// @brief Read exactly len bytes from a file descriptor.
+		/// @returns false on end of file before the first byte.
+		/// @throws std::runtime_error on error or end of file part way.
+		inline bool binaryReadAll(int fd, void * buf, std::size_t len) {
+			char * p = static_cast<char *>(buf);
+			std::size_t total = 0;
+			while (total < len) {
+#if defined(_WIN32)
+				const int ret = ::_read(fd, p + total, static_cast<unsigned int>(len - total));
+#else
+				const ssize_t ret = ::read(fd, p + total, len - total);
+#endif
+				if (ret < 0) {
+					if (errno == EINTR) {
+						continue;
+					}
+					throw std::runtime_error("Failed reading matrix data from file descriptor");
+				}
+				if (ret == 0) {
+					if (total == 0) {
+						return false;
+					}
+					throw std::runtime_error("Unexpected end of file in matrix data");
+				}
+				total += ret;
+			}
+			return true;
+		}
+
+		/// @internal
+		/// @brief Write the dimensions header, if any, returning its size.
+		template<typename Derived>
+		inline std::size_t binaryWriteHeader(unsigned char * out, Eigen::PlainObjectBase<Derived> const& m) {
+			typedef EigenBinaryLayout<Derived> layout;
+			binary_dim_type dims[2];
+			int n = 0;
+			if (layout::DynamicRows) {
+				dims[n++] = m.rows();
+			}
+			if (layout::DynamicCols) {
+				dims[n++] = m.cols();
+			}
+			binaryCopyLittleEndian(out, dims, n, sizeof(binary_dim_type));
+			return layout::HeaderBytes;
+		}
+	} // end of namespace detail
+
+/// @addtogroup Math Math Utilities
+/// @{
+
+	/** @name Binary matrix IO
+
+		The binary form of a matrix or array is its dimensions, for those
+		that are Dynamic at compile time only, as unsigned 64-bit integers,
+		followed by its coefficients in the type's storage order. Everything
+		is little-endian, so on little-endian machines the coefficients are
+		a single memcpy of the contiguous storage.
+
+		The form is not self-describing: read it back into the same type.
+	*/
+	/// @{
+
+	/// Number of bytes in the binary form of a matrix
+	template<typename Derived>
+	inline std::size_t binarySize(Eigen::PlainObjectBase<Derived> const& m) {
+		typedef detail::EigenBinaryLayout<Derived> layout;
+		return layout::HeaderBytes + m.size() * sizeof(typename layout::Scalar);
+	}
+
+	/// Write the binary form of a matrix to memory, which must have room
+	/// for binarySize(m) bytes.
+	/// @returns the number of bytes written
+	template<typename Derived>
+	inline std::size_t writeBinary(unsigned char * out, Eigen::PlainObjectBase<Derived> const& m) {
+		typedef typename Derived::Scalar Scalar;
+		const std::size_t header = detail::binaryWriteHeader(out, m);
+		detail::binaryCopyLittleEndian(out + header, m.data(), m.size(), sizeof(Scalar));
+		return header + m.size() * sizeof(Scalar);
+	}
+
+	/// Read the binary form of a matrix from memory, resizing the matrix
+	/// if it is dynamic-size.
+	/// @returns the number of bytes consumed, or 0 if fewer than a whole
+	/// matrix's worth of bytes are available.
+	/// @throws std::runtime_error if the dimensions are impossibly large
+	template<typename Derived>
+	inline std::size_t readBinary(unsigned char const* in, std::size_t available, Eigen::PlainObjectBase<Derived> & m) {
+		typedef detail::EigenBinaryLayout<Derived> layout;
+		typedef typename layout::Scalar Scalar;
+		if (available < std::size_t(layout::HeaderBytes)) {
+			return 0;
+		}
+		detail::binary_dim_type dims[2] = {0, 0};
+		detail::binaryCopyLittleEndian(dims, in, layout::DynamicRows + layout::DynamicCols, sizeof(detail::binary_dim_type));
+		const detail::binary_dim_type rows = layout::DynamicRows ? dims[0] : detail::binary_dim_type(Derived::RowsAtCompileTime);
+		const detail::binary_dim_type cols = layout::DynamicCols ? dims[layout::DynamicRows] : detail::binary_dim_type(Derived::ColsAtCompileTime);
+		const std::size_t total = detail::binaryCheckedSize<Derived>(rows, cols);
+		if (available < total) {
+			return 0;
+		}
+		m.resize(rows, cols);
+		detail::binaryCopyLittleEndian(m.data(), in + layout::HeaderBytes, m.size(), sizeof(Scalar));
+		return total;
+	}
+
+	/// Write count fixed-size matrices from a contiguous array (such as a
+	/// std::vector) with a single copy: no header is written.
+	/// @returns the number of bytes written
+	template<typename MatrixType>
+	inline std::size_t writeBinaryArray(unsigned char * out, MatrixType const* ms, std::size_t count) {
+		typedef typename MatrixType::Scalar Scalar;
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(MatrixType);
+		BOOST_STATIC_ASSERT_MSG(sizeof(MatrixType) == MatrixType::SizeAtCompileTime * sizeof(Scalar), "Matrix type must not be padded");
+		detail::binaryCopyLittleEndian(out, ms, count * MatrixType::SizeAtCompileTime, sizeof(Scalar));
+		return count * sizeof(MatrixType);
+	}
+
+	/// Read count fixed-size matrices into a contiguous array with a single copy.
+	/// @returns the number of bytes consumed
+	template<typename MatrixType>
+	inline std::size_t readBinaryArray(unsigned char const* in, MatrixType * ms, std::size_t count) {
+		typedef typename MatrixType::Scalar Scalar;
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(MatrixType);
+		BOOST_STATIC_ASSERT_MSG(sizeof(MatrixType) == MatrixType::SizeAtCompileTime * sizeof(Scalar), "Matrix type must not be padded");
+		detail::binaryCopyLittleEndian(ms, in, count * MatrixType::SizeAtCompileTime, sizeof(Scalar));
+		return count * sizeof(MatrixType);
+	}
+
+	/// Append the binary form of a matrix to a ReceiveBuffer, which must
+	/// have room for it.
+	template<std::size_t SIZE, typename Derived>
+	inline void appendBinary(ReceiveBuffer<SIZE, stdint::uint8_t> & buf, Eigen::PlainObjectBase<Derived> const& m) {
+		std::vector<unsigned char> bytes(binarySize(m));
+		if (!bytes.empty()) {
+			writeBinary(&bytes[0], m);
+			buf.push_back(bytes.begin(), bytes.end());
+		}
+	}
+
+	/// Remove the binary form of a matrix from the front of a ReceiveBuffer
+	/// into m, if all of it has been received.
+	/// @returns true if a matrix was read
+	/// @throws std::runtime_error if the dimensions are impossibly large
+	template<std::size_t SIZE, typename Derived>
+	inline bool consumeBinary(ReceiveBuffer<SIZE, stdint::uint8_t> & buf, Eigen::PlainObjectBase<Derived> & m) {
+		if (buf.empty()) {
+			return false;
+		}
+		const std::size_t consumed = readBinary(buf.data(), buf.size(), m);
+		if (consumed == 0) {
+			return false;
+		}
+		buf.pop_front(consumed);
+		return true;
+	}
+
+	/// Write the binary form of a matrix to a file descriptor. On
+	/// little-endian machines the coefficients are written directly from
+	/// the matrix storage.
+	/// @throws std::runtime_error on a write error
+	template<typename Derived>
+	inline void writeBinaryFD(int fd, Eigen::PlainObjectBase<Derived> const& m) {
+		typedef typename Derived::Scalar Scalar;
+		if (detail::binaryHostIsLittleEndian()) {
+			unsigned char header[2 * sizeof(detail::binary_dim_type)];
+			detail::binaryWriteAll(fd, header, detail::binaryWriteHeader(header, m));
+			detail::binaryWriteAll(fd, m.data(), m.size() * sizeof(Scalar));
+		} else {
+			std::vector<unsigned char> bytes(binarySize(m));
+			if (!bytes.empty()) {
+				detail::binaryWriteAll(fd, &bytes[0], writeBinary(&bytes[0], m));
+			}
+		}
+	}
+
+	/// Read the binary form of a matrix from a file descriptor.
+	/// @returns false at a clean end of file.
+	/// @throws std::runtime_error on a read error, a truncated matrix, or
+	/// impossibly large dimensions
+	template<typename Derived>
+	inline bool readBinaryFD(int fd, Eigen::PlainObjectBase<Derived> & m) {
+		typedef detail::EigenBinaryLayout<Derived> layout;
+		typedef typename layout::Scalar Scalar;
+		detail::binary_dim_type dims[2] = {0, 0};
+		if (layout::HeaderBytes > 0) {
+			if (!detail::binaryReadAll(fd, dims, layout::HeaderBytes)) {
+				return false;
+			}
+			detail::binaryCopyLittleEndian(dims, dims, layout::DynamicRows + layout::DynamicCols, sizeof(detail::binary_dim_type));
+		}
+		const detail::binary_dim_type rows = layout::DynamicRows ? dims[0] : detail::binary_dim_type(Derived::RowsAtCompileTime);
+		const detail::binary_dim_type cols = layout::DynamicCols ? dims[layout::DynamicRows] : detail::binary_dim_type(Derived::ColsAtCompileTime);
+		detail::binaryCheckedSize<Derived>(rows, cols);
+		m.resize(rows, cols);
+		if (m.size() == 0) {
+			return true;
+		}
+		if (!detail::binaryReadAll(fd, m.data(), m.size() * sizeof(Scalar))) {
+			if (layout::HeaderBytes > 0) {
+				throw std::runtime_error("Unexpected end of file in matrix data");
+			}
+			return false;
+		}
+		detail::binaryCopyLittleEndian(m.data(), m.data(), m.size(), sizeof(Scalar));
+		return true;
+	}
+
+	/// Write count fixed-size matrices from a contiguous array to a file
+	/// descriptor in a single call, as for writeBinaryArray().
+	/// @throws std::runtime_error on a write error
+	template<typename MatrixType>
+	inline void writeBinaryArrayFD(int fd, MatrixType const* ms, std::size_t count) {
+		if (detail::binaryHostIsLittleEndian()) {
+			EIGEN_STATIC_ASSERT_FIXED_SIZE(MatrixType);
+			BOOST_STATIC_ASSERT_MSG(sizeof(MatrixType) == MatrixType::SizeAtCompileTime * sizeof(typename MatrixType::Scalar), "Matrix type must not be padded");
+			detail::binaryWriteAll(fd, ms, count * sizeof(MatrixType));
+		} else {
+			std::vector<unsigned char> bytes(count * sizeof(MatrixType));
+			if (!bytes.empty()) {
+				detail::binaryWriteAll(fd, &bytes[0], writeBinaryArray(&bytes[0], ms, count));
+			}
+		}
+	}
+
+	/// Read count fixed-size matrices from a file descriptor into a
+	/// contiguous array in a single call.
+	/// @returns false at a clean end of file.
+	/// @throws std::runtime_error on a read error or truncated data
+	template<typename MatrixType>
+	inline bool readBinaryArrayFD(int fd, MatrixType * ms, std::size_t count) {
+		typedef typename MatrixType::Scalar Scalar;
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(MatrixType);
+		BOOST_STATIC_ASSERT_MSG(sizeof(MatrixType) == MatrixType::SizeAtCompileTime * sizeof(Scalar), "Matrix type must not be padded");
+		if (count == 0) {
+			return true;
+		}
+		if (!detail::binaryReadAll(fd, ms, count * sizeof(MatrixType))) {
+			return false;
+		}
+		detail::binaryCopyLittleEndian(ms, ms, count * MatrixType::SizeAtCompileTime, sizeof(Scalar));
+		return true;
+	}
+
+	/// @}
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_EigenBinaryIO_h_GUID_6a21f714_dbdd_4873_b187_f82f2a19540b
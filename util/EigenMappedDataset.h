@@ -0,0 +1,352 @@
+/** @file
+	@brief Flat, memory-mappable on-disk datasets of fixed-size Eigen
+	matrices, read in place through Eigen::Map without any per-matrix
+	deserialization.
+
+	A dataset file contains a fixed header followed by a payload of
+	back-to-back matrices, starting at a 64-byte aligned offset. The
+	payload is the exact object representation of the matrices, so a
+	reader maps the file and hands out Eigen::Map views into it: opening
+	a dataset costs only the mapping itself, and replaying one is bounded
+	by I/O rather than by copying.
+
+	Numbers are stored in native byte order: the header records a
+	byte-order mark and datasets from a different-endian machine are
+	rejected when opened. Use EigenBinaryIO.h for a portable format.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_EigenMappedDataset_h_GUID_b79cd1f6_14c8_4dff_a813_858bbfbdb785
+#define INCLUDED_EigenMappedDataset_h_GUID_b79cd1f6_14c8_4dff_a813_858bbfbdb785
+
+// Internal Includes
+#include <util/ReadOnlyFileMapping.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_signed.hpp>
+
+// Standard includes
+#include <string>
+#include <fstream>
+#include <cstring>
+#include <cstddef>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+namespace util {
+
+	namespace detail {
+		/// @internal
+		/// @brief Fixed-size header at the start of a dataset file.
+		struct MatrixDatasetHeader {
+			char magic[8];
+			stdint::uint32_t byteOrderMark;
+			stdint::uint32_t scalarKind;
+			stdint::uint32_t scalarSize;
+			stdint::uint32_t rows;
+			stdint::uint32_t cols;
+			stdint::uint32_t rowMajor;
+			stdint::uint64_t count;
+			stdint::uint64_t payloadStart;
+			stdint::uint64_t matrixBytes;
+		};
+
+		static const char MATRIX_DATASET_MAGIC[8] = {'U', 'T', 'I', 'L', 'M', 'A', 'T', '1'};
+		static const stdint::uint32_t MATRIX_DATASET_BYTE_ORDER_MARK = 0x01020304;
+
+		/// @internal
+		/// @brief Payload alignment: a cache line, which also satisfies
+		/// Eigen's vectorization requirements.
+		static const stdint::uint64_t MATRIX_DATASET_ALIGNMENT = 64;
+
+		/// @internal
+		/// @brief Checks and describes a matrix type that can be stored in
+		/// a dataset.
+		template<typename MatrixType>
+		struct MatrixDatasetTraits {
+			typedef typename MatrixType::Scalar Scalar;
+			BOOST_STATIC_ASSERT_MSG(MatrixType::RowsAtCompileTime != Eigen::Dynamic && MatrixType::ColsAtCompileTime != Eigen::Dynamic,
+			                        "Only fixed-size matrices can be stored in a mapped dataset.");
+			BOOST_STATIC_ASSERT_MSG(sizeof(MatrixType) == sizeof(Scalar) * MatrixType::RowsAtCompileTime * MatrixType::ColsAtCompileTime,
+			                        "Matrix type must not contain padding.");
+
+			/// 0 for unsigned integers, 1 for signed integers, 2 for floating point
+			static stdint::uint32_t scalarKind() {
+				return boost::is_floating_point<Scalar>::value ? 2 : (boost::is_signed<Scalar>::value ? 1 : 0);
+			}
+
+			static void fillHeader(MatrixDatasetHeader & header) {
+				std::memset(&header, 0, sizeof(header));
+				std::memcpy(header.magic, MATRIX_DATASET_MAGIC, sizeof(header.magic));
+				header.byteOrderMark = MATRIX_DATASET_BYTE_ORDER_MARK;
+				header.scalarKind = scalarKind();
+				header.scalarSize = sizeof(Scalar);
+				header.rows = MatrixType::RowsAtCompileTime;
+				header.cols = MatrixType::ColsAtCompileTime;
+				header.rowMajor = MatrixType::IsRowMajor ? 1 : 0;
+				header.count = 0;
+				header.payloadStart = MATRIX_DATASET_ALIGNMENT;
+				header.matrixBytes = sizeof(MatrixType);
+			}
+		};
+
+		BOOST_STATIC_ASSERT(sizeof(MatrixDatasetHeader) <= MATRIX_DATASET_ALIGNMENT);
+	} // end of namespace detail
+
+/// @addtogroup Math Math Utilities
+/// @{
+
+	/** @brief Appends fixed-size matrices to a dataset file that can later be
+		opened with MappedMatrixDataset.
+
+		The header's count is filled in by close(), which the destructor
+		calls if you don't: a file that was never closed opens as empty.
+	*/
+	template<typename MatrixType>
+	class MatrixDatasetWriter : boost::noncopyable {
+		public:
+			typedef detail::MatrixDatasetTraits<MatrixType> traits_type;
+			typedef stdint::uint64_t count_type;
+
+			/// Create (or truncate) the given dataset file.
+			/// @throws std::runtime_error if the file could not be opened.
+			explicit MatrixDatasetWriter(std::string const& filename)
+				: _filename(filename)
+				, _out(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc)
+				, _count(0) {
+				if (!_out) {
+					throw std::runtime_error("Could not open dataset file for writing: " + filename);
+				}
+				detail::MatrixDatasetHeader header;
+				traits_type::fillHeader(header);
+				static const char padding[detail::MATRIX_DATASET_ALIGNMENT] = {0};
+				_out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+				_out.write(padding, header.payloadStart - sizeof(header));
+				_check();
+			}
+
+			~MatrixDatasetWriter() {
+				try {
+					close();
+				} catch (std::exception &) {
+					/// Can't report errors from a destructor: call close() yourself to see them.
+				}
+			}
+
+			/// Append a single matrix
+			void append(MatrixType const& m) {
+				append(&m, 1);
+			}
+
+			/// Append n contiguous matrices with a single write.
+			void append(const MatrixType * ms, std::size_t n) {
+				if (!_out.is_open()) {
+					throw std::logic_error("Appending to a closed dataset: " + _filename);
+				}
+				_out.write(reinterpret_cast<const char *>(ms), n * sizeof(MatrixType));
+				_check();
+				_count += n;
+			}
+
+			/// Number of matrices appended so far
+			count_type size() const {
+				return _count;
+			}
+
+			/// Record the final count in the header and close the file.
+			/// Safe to call more than once.
+			/// @throws std::runtime_error if writing failed.
+			void close() {
+				if (!_out.is_open()) {
+					return;
+				}
+				_out.seekp(offsetof(detail::MatrixDatasetHeader, count));
+				_out.write(reinterpret_cast<const char *>(&_count), sizeof(_count));
+				_check();
+				_out.close();
+			}
+
+		private:
+			void _check() {
+				if (!_out) {
+					throw std::runtime_error("Failed writing dataset file: " + _filename);
+				}
+			}
+
+			std::string _filename;
+			std::ofstream _out;
+			count_type _count;
+	};
+
+	/// @brief Write n contiguous matrices to a new dataset file in one go.
+	/// @throws std::runtime_error if the file could not be written.
+	template<typename MatrixType>
+	void saveMatrixDataset(std::string const& filename, const MatrixType * ms, std::size_t n) {
+		MatrixDatasetWriter<MatrixType> writer(filename);
+		writer.append(ms, n);
+		writer.close();
+	}
+
+	/// Access pattern hints for MappedMatrixDataset
+	enum MatrixDatasetAccess {
+		/// No particular pattern
+		DatasetNormalAccess,
+		/// Front-to-back replay: read ahead aggressively
+		DatasetSequentialAccess,
+		/// Scattered lookups: don't bother reading ahead
+		DatasetRandomAccess
+	};
+
+	/** @brief Read-only view of a dataset file written by MatrixDatasetWriter
+		or saveMatrixDataset(), memory-mapped and accessed in place.
+
+		Element access returns an Eigen::Map into the mapping, valid as long
+		as the dataset object is: nothing is allocated or copied per matrix.
+	*/
+	template<typename MatrixType>
+	class MappedMatrixDataset : boost::noncopyable {
+		public:
+			typedef detail::MatrixDatasetTraits<MatrixType> traits_type;
+			typedef Eigen::Map<const MatrixType> const_reference;
+			typedef stdint::uint64_t count_type;
+
+			/// Map the given dataset file.
+			/// @throws std::runtime_error if the file is missing, empty,
+			/// truncated, or not a compatible dataset for this matrix type.
+			explicit MappedMatrixDataset(std::string const& filename, MatrixDatasetAccess access = DatasetSequentialAccess)
+				: _file(detail::openReadOnlyFile(filename, "matrix dataset"))
+				, _region(detail::mapReadOnlyFile(_file, filename, "matrix dataset")) {
+				const char * base = static_cast<const char *>(_region.get_address());
+				const std::size_t mappedSize = _region.get_size();
+				if (mappedSize < sizeof(detail::MatrixDatasetHeader)) {
+					throw std::runtime_error("File too small to be a matrix dataset: " + filename);
+				}
+				std::memcpy(&_header, base, sizeof(_header));
+				if (std::memcmp(_header.magic, detail::MATRIX_DATASET_MAGIC, sizeof(_header.magic)) != 0) {
+					throw std::runtime_error("Not a matrix dataset: " + filename);
+				}
+				if (_header.byteOrderMark != detail::MATRIX_DATASET_BYTE_ORDER_MARK) {
+					throw std::runtime_error("Matrix dataset was written with a different byte order: " + filename);
+				}
+				detail::MatrixDatasetHeader expected;
+				traits_type::fillHeader(expected);
+				if (_header.scalarKind != expected.scalarKind || _header.scalarSize != expected.scalarSize
+				        || _header.rows != expected.rows || _header.cols != expected.cols
+				        || _header.rowMajor != expected.rowMajor || _header.matrixBytes != expected.matrixBytes) {
+					throw std::runtime_error("Matrix dataset holds a different matrix type: " + filename);
+				}
+				/// The header is untrusted: compare against the remaining space
+				/// so that no sum or product can wrap.
+				if (_header.payloadStart % detail::MATRIX_DATASET_ALIGNMENT != 0
+				        || _header.payloadStart > mappedSize
+				        || _header.count > (mappedSize - _header.payloadStart) / _header.matrixBytes) {
+					throw std::runtime_error("Matrix dataset file is truncated: " + filename);
+				}
+				_payload = reinterpret_cast<const typename MatrixType::Scalar *>(base + _header.payloadStart);
+				advise(access);
+			}
+
+			/// Number of matrices in the dataset
+			count_type size() const {
+				return _header.count;
+			}
+
+			bool empty() const {
+				return size() == 0;
+			}
+
+			/// Unchecked access to matrix i
+			const_reference operator[](count_type i) const {
+				return const_reference(_payload + i * MatrixType::SizeAtCompileTime);
+			}
+
+			/// Checked access to matrix i
+			/// @throws std::out_of_range
+			const_reference get(count_type i) const {
+				if (i >= size()) {
+					throw std::out_of_range("Matrix dataset index out of range!");
+				}
+				return (*this)[i];
+			}
+
+			/// The whole payload, as size() contiguous matrices.
+			const MatrixType * data() const {
+				return reinterpret_cast<const MatrixType *>(_payload);
+			}
+
+			/// Hint the expected access pattern for the whole dataset to the OS.
+			/// @returns false if the hint is not supported on this platform.
+			bool advise(MatrixDatasetAccess access) {
+				switch (access) {
+					case DatasetSequentialAccess:
+						return _region.advise(boost::interprocess::mapped_region::advice_sequential);
+					case DatasetRandomAccess:
+						return _region.advise(boost::interprocess::mapped_region::advice_random);
+					default:
+						return _region.advise(boost::interprocess::mapped_region::advice_normal);
+				}
+			}
+
+			/// Ask the OS to start reading in matrices [first, first + n),
+			/// for instance the next window of a replay, without blocking.
+			/// Out-of-range parts are ignored.
+			/// @returns false if the hint is not supported on this platform.
+			bool prefetch(count_type first, count_type n) const {
+				if (first >= size() || n == 0) {
+					return true;
+				}
+				if (n > size() - first) {
+					n = size() - first;
+				}
+#ifdef _WIN32
+				return false;
+#else
+				const std::size_t pageSize = boost::interprocess::mapped_region::get_page_size();
+				const char * begin = reinterpret_cast<const char *>(_payload) + first * _header.matrixBytes;
+				const char * end = begin + n * _header.matrixBytes;
+				const char * base = static_cast<const char *>(_region.get_address());
+				/// The mapping itself is page aligned, so round relative to it.
+				const std::size_t offset = static_cast<std::size_t>(begin - base) / pageSize * pageSize;
+				return 0 == ::posix_madvise(const_cast<char *>(base + offset), static_cast<std::size_t>(end - base) - offset,
+				                            POSIX_MADV_WILLNEED);
+#endif
+			}
+
+		private:
+			boost::interprocess::file_mapping _file;
+			boost::interprocess::mapped_region _region;
+			detail::MatrixDatasetHeader _header;
+			const typename MatrixType::Scalar * _payload;
+	};
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_EigenMappedDataset_h_GUID_b79cd1f6_14c8_4dff_a813_858bbfbdb785
@@ -1,9 +1,23 @@
 /** @file
-	@brief Header
+	@brief Header providing Boost.Serialization support for Eigen dense
+	matrices and arrays (fixed or dynamic size), Map views, and compressed
+	sparse matrices.
+
+	Fixed-size matrices are stored as just their coefficients, as they always
+	have been. Dynamic dimensions are stored ahead of the coefficients, so
+	a Map of a plain type is archive-compatible with that plain type.
+
+	Sparse matrices are stored in their native compressed form: a row-major
+	SparseMatrix is written as CSR (row offsets, column indices, values),
+	a column-major one as CSC. Each of the three arrays is a single bulk
+	array transfer, so binary archives copy them directly. To use the sparse
+	support, include <Eigen/Sparse> (with
+	EIGEN_YES_I_KNOW_SPARSE_MODULE_IS_NOT_STABLE_YET defined) yourself: this
+	header does not pull it in.
 
 	@versioninfo@
 
-	@date 2011
+	@date 2011, 2026
 
 	@author
 	Ryan Pavlik
@@ -13,7 +27,7 @@
 	Human-Computer Interaction Graduate Program
 */
 
-//          Copyright Iowa State University 2011.
+//          Copyright Iowa State University 2011, 2026.
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
@@ -28,17 +42,256 @@
 // Library/third-party includes
 #include <Eigen/Core>
 #include <boost/serialization/array.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_free.hpp>
 
 // Standard includes
-// - none
+#include <stdexcept>
+
+namespace Eigen {
+	/// Declared here (without defaults) so the sparse overloads below don't
+	/// require the unstable Sparse module unless they are actually used.
+	template<typename _Scalar, int _Flags, typename _Index> class SparseMatrix;
+} // end of namespace Eigen
+
+namespace util {
+	namespace detail {
+		/// @internal
+		/// @brief Save any dynamic dimensions of a dense expression.
+		template<typename PlainType, typename Archive, typename Derived>
+		void saveEigenDims(Archive & ar, Eigen::DenseBase<Derived> const& m) {
+			if (PlainType::RowsAtCompileTime == Eigen::Dynamic) {
+				const Eigen::DenseIndex rows = m.rows();
+				ar << boost::serialization::make_nvp("rows", rows);
+			}
+			if (PlainType::ColsAtCompileTime == Eigen::Dynamic) {
+				const Eigen::DenseIndex cols = m.cols();
+				ar << boost::serialization::make_nvp("cols", cols);
+			}
+		}
+
+		/// @internal
+		/// @brief Load the dimensions written by saveEigenDims, filling in
+		/// the compile-time ones.
+		template<typename PlainType, typename Archive>
+		void loadEigenDims(Archive & ar, Eigen::DenseIndex & rows, Eigen::DenseIndex & cols) {
+			rows = PlainType::RowsAtCompileTime;
+			cols = PlainType::ColsAtCompileTime;
+			if (PlainType::RowsAtCompileTime == Eigen::Dynamic) {
+				ar >> boost::serialization::make_nvp("rows", rows);
+			}
+			if (PlainType::ColsAtCompileTime == Eigen::Dynamic) {
+				ar >> boost::serialization::make_nvp("cols", cols);
+			}
+			if (rows < 0 || cols < 0) {
+				throw std::runtime_error("Negative dimension in serialized Eigen matrix");
+			}
+		}
+
+		/// @internal
+		template<typename Archive, typename Derived>
+		void savePlain(Archive & ar, Eigen::PlainObjectBase<Derived> const& m) {
+			saveEigenDims<Derived>(ar, m);
+			ar << boost::serialization::make_array(m.data(), m.size());
+		}
+
+		/// @internal
+		template<typename Archive, typename Derived>
+		void loadPlain(Archive & ar, Eigen::PlainObjectBase<Derived> & m) {
+			Eigen::DenseIndex rows, cols;
+			loadEigenDims<Derived>(ar, rows, cols);
+			m.resize(rows, cols);
+			ar >> boost::serialization::make_array(m.data(), m.size());
+		}
+
+		/// @internal
+		/// @brief Visit the coefficients of a mapped expression in storage
+		/// order, one bulk array per inner vector (or one for all of them
+		/// if the map is contiguous).
+		template<typename Archive, typename MapType, typename Pointer, typename Op>
+		void transferMapped(Archive & ar, MapType const& m, Pointer data, Op op) {
+			if (m.size() == 0) {
+				return;
+			}
+			if (m.innerStride() == 1 && (m.outerSize() == 1 || m.outerStride() == m.innerSize())) {
+				op(ar, boost::serialization::make_array(data, m.size()));
+				return;
+			}
+			for (Eigen::DenseIndex outer = 0; outer < m.outerSize(); ++outer) {
+				Pointer innerStart = data + outer * m.outerStride();
+				if (m.innerStride() == 1) {
+					op(ar, boost::serialization::make_array(innerStart, m.innerSize()));
+				} else {
+					for (Eigen::DenseIndex inner = 0; inner < m.innerSize(); ++inner) {
+						op(ar, boost::serialization::make_nvp("item", innerStart[inner * m.innerStride()]));
+					}
+				}
+			}
+		}
+
+		/// @internal
+		struct SaveOp {
+			template<typename Archive, typename T>
+			void operator()(Archive & ar, T const& t) const {
+				ar << t;
+			}
+		};
+
+		/// @internal
+		struct LoadOp {
+			template<typename Archive, typename T>
+			void operator()(Archive & ar, T const& t) const {
+				ar >> t;
+			}
+		};
+
+		/// @internal
+		/// @brief Whether compressed sparse outer offsets start at 0, never
+		/// decrease, and end at nonZeros.
+		template<typename Index>
+		bool sparseOuterIndexValid(Index const* outer, Index outerSize, Index nonZeros) {
+			if (outer[0] != 0 || outer[outerSize] != nonZeros) {
+				return false;
+			}
+			for (Index j = 0; j < outerSize; ++j) {
+				if (outer[j + 1] < outer[j]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// @internal
+		/// @brief Whether the inner indices of each outer vector are in
+		/// [0, innerSize) and strictly increasing, as Eigen assumes.
+		template<typename Index>
+		bool sparseInnerIndexValid(Index const* outer, Index outerSize, Index const* inner, Index innerSize) {
+			for (Index j = 0; j < outerSize; ++j) {
+				for (Index k = outer[j]; k < outer[j + 1]; ++k) {
+					if (inner[k] < 0 || inner[k] >= innerSize || (k > outer[j] && inner[k] <= inner[k - 1])) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	} // end of namespace detail
+} // end of namespace util
 
 namespace boost {
 	namespace serialization {
 
-		template<class Archive, class Scalar, int RowsAtCompileTime, int ColsAtCompileTime>
-		void serialize(Archive & ar, ::Eigen::Matrix<Scalar, RowsAtCompileTime, ColsAtCompileTime> & m, const unsigned int /*version*/) {
-			ar & boost::serialization::make_array(m.data(), RowsAtCompileTime * ColsAtCompileTime);
+		/// @name Dense matrices and arrays
+		/// @{
+		template<class Archive, typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		void save(Archive & ar, ::Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols> const& m, const unsigned int /*version*/) {
+			::util::detail::savePlain(ar, m);
+		}
+
+		template<class Archive, typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		void load(Archive & ar, ::Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols> & m, const unsigned int /*version*/) {
+			::util::detail::loadPlain(ar, m);
+		}
+
+		template<class Archive, typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		void serialize(Archive & ar, ::Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols> & m, const unsigned int version) {
+			split_free(ar, m, version);
+		}
+
+		template<class Archive, typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		void save(Archive & ar, ::Eigen::Array<Scalar, Rows, Cols, Options, MaxRows, MaxCols> const& m, const unsigned int /*version*/) {
+			::util::detail::savePlain(ar, m);
+		}
+
+		template<class Archive, typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		void load(Archive & ar, ::Eigen::Array<Scalar, Rows, Cols, Options, MaxRows, MaxCols> & m, const unsigned int /*version*/) {
+			::util::detail::loadPlain(ar, m);
+		}
+
+		template<class Archive, typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		void serialize(Archive & ar, ::Eigen::Array<Scalar, Rows, Cols, Options, MaxRows, MaxCols> & m, const unsigned int version) {
+			split_free(ar, m, version);
+		}
+		/// @}
+
+		/// @name Map views
+		/// @brief Written exactly like the mapped plain type. A map cannot be
+		/// resized, so loading into one whose dimensions differ from the
+		/// archived ones throws std::runtime_error.
+		/// @{
+		template<class Archive, typename PlainObjectType, int MapOptions, typename StrideType>
+		void save(Archive & ar, ::Eigen::Map<PlainObjectType, MapOptions, StrideType> const& m, const unsigned int /*version*/) {
+			::util::detail::saveEigenDims<PlainObjectType>(ar, m);
+			::util::detail::transferMapped(ar, m, m.data(), ::util::detail::SaveOp());
+		}
+
+		template<class Archive, typename PlainObjectType, int MapOptions, typename StrideType>
+		void load(Archive & ar, ::Eigen::Map<PlainObjectType, MapOptions, StrideType> & m, const unsigned int /*version*/) {
+			::Eigen::DenseIndex rows, cols;
+			::util::detail::loadEigenDims<PlainObjectType>(ar, rows, cols);
+			if (rows != m.rows() || cols != m.cols()) {
+				throw std::runtime_error("Serialized Eigen matrix dimensions do not match the Map being loaded into");
+			}
+			::util::detail::transferMapped(ar, m, m.data(), ::util::detail::LoadOp());
+		}
+
+		template<class Archive, typename PlainObjectType, int MapOptions, typename StrideType>
+		void serialize(Archive & ar, ::Eigen::Map<PlainObjectType, MapOptions, StrideType> & m, const unsigned int version) {
+			split_free(ar, m, version);
+		}
+		/// @}
+
+		/// @name Compressed sparse matrices
+		/// @brief Requires <Eigen/Sparse>. The matrix must be finalized.
+		/// Loading checks the index arrays, and throws std::runtime_error
+		/// (leaving an empty matrix) if they do not describe a valid one.
+		/// @{
+		template<class Archive, typename Scalar, int Flags, typename Index>
+		void save(Archive & ar, ::Eigen::SparseMatrix<Scalar, Flags, Index> const& m, const unsigned int /*version*/) {
+			const Index rows = m.rows();
+			const Index cols = m.cols();
+			const Index nonZeros = m.nonZeros();
+			ar << make_nvp("rows", rows);
+			ar << make_nvp("cols", cols);
+			ar << make_nvp("nonZeros", nonZeros);
+			ar << make_nvp("outerIndex", make_array(m._outerIndexPtr(), m.outerSize() + 1));
+			if (nonZeros > 0) {
+				ar << make_nvp("innerIndex", make_array(m._innerIndexPtr(), nonZeros));
+				ar << make_nvp("values", make_array(m._valuePtr(), nonZeros));
+			}
+		}
+
+		template<class Archive, typename Scalar, int Flags, typename Index>
+		void load(Archive & ar, ::Eigen::SparseMatrix<Scalar, Flags, Index> & m, const unsigned int /*version*/) {
+			Index rows, cols, nonZeros;
+			ar >> make_nvp("rows", rows);
+			ar >> make_nvp("cols", cols);
+			ar >> make_nvp("nonZeros", nonZeros);
+			if (rows < 0 || cols < 0 || nonZeros < 0) {
+				throw std::runtime_error("Negative size in serialized Eigen sparse matrix");
+			}
+			m.resize(rows, cols);
+			m.resizeNonZeros(nonZeros);
+			ar >> make_nvp("outerIndex", make_array(m._outerIndexPtr(), m.outerSize() + 1));
+			if (!::util::detail::sparseOuterIndexValid(m._outerIndexPtr(), Index(m.outerSize()), nonZeros)) {
+				m.resize(rows, cols);
+				throw std::runtime_error("Inconsistent outer index in serialized Eigen sparse matrix");
+			}
+			if (nonZeros > 0) {
+				ar >> make_nvp("innerIndex", make_array(m._innerIndexPtr(), nonZeros));
+				if (!::util::detail::sparseInnerIndexValid(m._outerIndexPtr(), Index(m.outerSize()), m._innerIndexPtr(), Index(m.innerSize()))) {
+					m.resize(rows, cols);
+					throw std::runtime_error("Invalid inner index in serialized Eigen sparse matrix");
+				}
+				ar >> make_nvp("values", make_array(m._valuePtr(), nonZeros));
+			}
+		}
+
+		template<class Archive, typename Scalar, int Flags, typename Index>
+		void serialize(Archive & ar, ::Eigen::SparseMatrix<Scalar, Flags, Index> & m, const unsigned int version) {
+			split_free(ar, m, version);
 		}
+		/// @}
 
 	} // end of namespace serialization
 } // end of namespace boost
@@ -0,0 +1,454 @@
+/** @file
+	@brief Lossy, compact encoding of rigid poses for network replication:
+	a quantized position plus a "smallest three" quaternion, delta-encoded
+	against a baseline pose both ends already share.
+
+	Quantizing is the lossy step, and its precision is configurable: a
+	position step size (in your length units) and a bit count for each
+	stored quaternion component. Delta encoding is lossless on top of
+	that: the differences from the baseline's quantized values are written
+	as zigzag variable-length integers, so slow-moving objects take only
+	a few bytes.
+
+	A pose encodes to at most POSE_DELTA_MAX_BYTES bytes. With the default
+	precision, a tracked object moving at walking speed with a 60Hz update
+	rate typically encodes to 8 to 13 bytes, compared to the 128 (plus
+	archive overhead) of a serialized Eigen::Matrix4d.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_EigenPoseQuantize_h_GUID_36b56a2a_bd2a_4f1e_8290_73f9d581ba8d
+#define INCLUDED_EigenPoseQuantize_h_GUID_36b56a2a_bd2a_4f1e_8290_73f9d581ba8d
+
+// Internal Includes
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+// Standard includes
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTIL_POSEQUANTIZE_SSE2
+#endif
+
+namespace util {
+
+	namespace detail {
+		/// @internal
+		/// @brief Largest magnitude of a quantized value: keeps the
+		/// difference of any two within an int32.
+		static const double POSE_QUANTIZED_LIMIT = 1073741823.0;
+
+		/// @internal
+		/// @brief Adding and subtracting this rounds a double to the
+		/// nearest integer (ties to even), identically in scalar and SIMD code.
+		static const double POSE_ROUNDING_MAGIC = 6755399441055744.0;
+
+		/// @internal
+		/// @brief Scalar reference for quantizeLanes: round in[i] * scale
+		/// to integers.
+		/// @returns false if any lane falls outside POSE_QUANTIZED_LIMIT.
+		inline bool quantizeLanesScalar(const double * in, double scale, stdint::int32_t * out) {
+			double rounded[4];
+			for (int i = 0; i < 4; ++i) {
+				rounded[i] = (in[i] * scale + POSE_ROUNDING_MAGIC) - POSE_ROUNDING_MAGIC;
+				if (!(std::fabs(rounded[i]) <= POSE_QUANTIZED_LIMIT)) {
+					return false;
+				}
+			}
+			for (int i = 0; i < 4; ++i) {
+				out[i] = static_cast<stdint::int32_t>(rounded[i]);
+			}
+			return true;
+		}
+
+		/// @internal
+		/// @brief Scalar reference for dequantizeLanes.
+		inline void dequantizeLanesScalar(const stdint::int32_t * in, double step, double * out) {
+			for (int i = 0; i < 4; ++i) {
+				out[i] = double(in[i]) * step;
+			}
+		}
+
+#if defined(__AVX__)
+#define UTIL_POSEQUANTIZE_PACKETS
+		/// @internal
+		/// @brief Quantize four lanes at once: see quantizeLanesScalar.
+		inline bool quantizeLanes(const double * in, double scale, stdint::int32_t * out) {
+			const __m256d magic = _mm256_set1_pd(POSE_ROUNDING_MAGIC);
+			const __m256d rounded = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(in), _mm256_set1_pd(scale)), magic), magic);
+			const __m256d magnitude = _mm256_andnot_pd(_mm256_set1_pd(-0.0), rounded);
+			if (_mm256_movemask_pd(_mm256_cmp_pd(magnitude, _mm256_set1_pd(POSE_QUANTIZED_LIMIT), _CMP_LE_OQ)) != 0xf) {
+				return false;
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_cvttpd_epi32(rounded));
+			return true;
+		}
+
+		/// @internal
+		inline void dequantizeLanes(const stdint::int32_t * in, double step, double * out) {
+			const __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+			_mm256_storeu_pd(out, _mm256_mul_pd(_mm256_cvtepi32_pd(q), _mm256_set1_pd(step)));
+		}
+#elif defined(UTIL_POSEQUANTIZE_SSE2)
+#define UTIL_POSEQUANTIZE_PACKETS
+		/// @internal
+		/// @brief Quantize four lanes at once: see quantizeLanesScalar.
+		inline bool quantizeLanes(const double * in, double scale, stdint::int32_t * out) {
+			const __m128d magic = _mm_set1_pd(POSE_ROUNDING_MAGIC);
+			const __m128d s = _mm_set1_pd(scale);
+			const __m128d lo = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(_mm_loadu_pd(in), s), magic), magic);
+			const __m128d hi = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(_mm_loadu_pd(in + 2), s), magic), magic);
+			const __m128d signBit = _mm_set1_pd(-0.0);
+			const __m128d limit = _mm_set1_pd(POSE_QUANTIZED_LIMIT);
+			const int inRange = _mm_movemask_pd(_mm_cmple_pd(_mm_andnot_pd(signBit, lo), limit))
+			                    & _mm_movemask_pd(_mm_cmple_pd(_mm_andnot_pd(signBit, hi), limit));
+			if (inRange != 0x3) {
+				return false;
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi)));
+			return true;
+		}
+
+		/// @internal
+		inline void dequantizeLanes(const stdint::int32_t * in, double step, double * out) {
+			const __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+			const __m128d s = _mm_set1_pd(step);
+			_mm_storeu_pd(out, _mm_mul_pd(_mm_cvtepi32_pd(q), s));
+			_mm_storeu_pd(out + 2, _mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(q, 8)), s));
+		}
+#else
+		inline bool quantizeLanes(const double * in, double scale, stdint::int32_t * out) {
+			return quantizeLanesScalar(in, scale, out);
+		}
+
+		inline void dequantizeLanes(const stdint::int32_t * in, double step, double * out) {
+			dequantizeLanesScalar(in, step, out);
+		}
+#endif
+
+		/// @internal
+		inline stdint::uint32_t poseZigZag(stdint::int32_t v) {
+			return (stdint::uint32_t(v) << 1) ^ stdint::uint32_t(v >> 31);
+		}
+
+		/// @internal
+		inline stdint::int32_t poseUnZigZag(stdint::uint32_t v) {
+			return stdint::int32_t(v >> 1) ^ -stdint::int32_t(v & 1);
+		}
+
+		/// @internal
+		/// @brief Apply a decoded delta with wraparound, so malformed input
+		/// can't cause signed overflow.
+		inline stdint::int32_t poseApplyDelta(stdint::int32_t base, stdint::int32_t delta) {
+			return static_cast<stdint::int32_t>(stdint::uint32_t(base) + stdint::uint32_t(delta));
+		}
+
+		/// @internal
+		inline std::size_t poseWriteVarint(unsigned char * out, stdint::uint32_t v) {
+			std::size_t n = 0;
+			while (v >= 0x80) {
+				out[n++] = static_cast<unsigned char>(v | 0x80);
+				v >>= 7;
+			}
+			out[n++] = static_cast<unsigned char>(v);
+			return n;
+		}
+
+		/// @internal
+		/// @returns bytes consumed, or 0 if the input ends first.
+		/// @throws std::runtime_error if the varint is too long to be valid.
+		inline std::size_t poseReadVarint(const unsigned char * in, std::size_t available, stdint::uint32_t & v) {
+			v = 0;
+			for (std::size_t n = 0; n < available; ++n) {
+				if (n == 5) {
+					throw std::runtime_error("Malformed pose encoding: integer too long");
+				}
+				v |= stdint::uint32_t(in[n] & 0x7f) << (7 * n);
+				if (!(in[n] & 0x80)) {
+					return n + 1;
+				}
+			}
+			return 0;
+		}
+	} // end of namespace detail
+
+/// @addtogroup Math Math Utilities
+/// @{
+
+	/// @brief Encoded size limit of one pose: a flags byte and six
+	/// variable-length integers of up to 5 bytes each.
+	static const std::size_t POSE_DELTA_MAX_BYTES = 31;
+
+	/** @brief A pose after quantization by a PoseQuantizer: the unit that
+		gets delta-encoded.
+
+		Default-constructed, it is the identity pose at the origin, which
+		makes a reasonable baseline before anything has been acknowledged.
+	*/
+	struct QuantizedPose {
+		QuantizedPose() : largest(3) {
+			for (int i = 0; i < 3; ++i) {
+				position[i] = 0;
+				rotation[i] = 0;
+			}
+		}
+
+		/// Position, in multiples of the quantizer's position step
+		stdint::int32_t position[3];
+		/// The three smallest quaternion components, in (x, y, z, w) order
+		/// skipping the largest, in multiples of the rotation step
+		stdint::int32_t rotation[3];
+		/// Index (in x, y, z, w order) of the omitted largest component,
+		/// which is non-negative and rebuilt from the unit length.
+		stdint::uint8_t largest;
+
+		bool operator==(QuantizedPose const& other) const {
+			for (int i = 0; i < 3; ++i) {
+				if (position[i] != other.position[i] || rotation[i] != other.rotation[i]) {
+					return false;
+				}
+			}
+			return largest == other.largest;
+		}
+
+		bool operator!=(QuantizedPose const& other) const {
+			return !(*this == other);
+		}
+	};
+
+	/** @brief Converts poses to and from QuantizedPose at a configurable
+		precision.
+
+		Both ends of a connection must use the same precision.
+		Quantization of the position and of the quaternion components uses
+		SSE2 or AVX when available, with results identical to the scalar
+		code.
+	*/
+	class PoseQuantizer {
+		public:
+			/** @param positionStep Position resolution: coordinates are rounded
+				to a multiple of this, and must stay within 2^30 steps of the origin.
+				@param rotationBits Bits per stored quaternion component
+				(including sign), from 2 to 30. Each is rounded to within
+				2^(-rotationBits) / sqrt(2) of the original.
+				@throws std::invalid_argument for precisions out of range.
+			*/
+			explicit PoseQuantizer(double positionStep = 0.0001, unsigned int rotationBits = 14)
+				: _positionStep(positionStep)
+				, _positionScale(1.0 / positionStep)
+				, _rotationBits(rotationBits) {
+				if (!(positionStep > 0)) {
+					throw std::invalid_argument("Pose position step must be positive");
+				}
+				if (rotationBits < 2 || rotationBits > 30) {
+					throw std::invalid_argument("Pose rotation bits must be between 2 and 30");
+				}
+				/// Components other than the largest are within +/- 1/sqrt(2)
+				const double maxQuantized = std::ldexp(1.0, int(rotationBits) - 1) - 1.0;
+				_rotationScale = maxQuantized * std::sqrt(2.0);
+				_rotationStep = 1.0 / _rotationScale;
+			}
+
+			double positionStep() const {
+				return _positionStep;
+			}
+
+			unsigned int rotationBits() const {
+				return _rotationBits;
+			}
+
+			/// Quantize a position and unit quaternion.
+			/// @throws std::out_of_range if the position is too far from the
+			/// origin (or not finite) for the position step.
+			QuantizedPose quantize(Eigen::Vector3d const& position, Eigen::Quaterniond const& rotation) const {
+				const double lanes[4] = {position[0], position[1], position[2], 0.0};
+				return _quantize(lanes, rotation);
+			}
+
+			/// Quantize a rigid transformation matrix.
+			/// @throws std::out_of_range as above.
+			QuantizedPose quantize(Eigen::Matrix4d const& pose) const {
+				/// Only the translation is range-checked, not the bottom corner.
+				const double lanes[4] = {pose(0, 3), pose(1, 3), pose(2, 3), 0.0};
+				return _quantize(lanes, Eigen::Quaterniond(Eigen::Matrix3d(pose.topLeftCorner<3, 3>())));
+			}
+
+			/// Quantize n rigid transformation matrices.
+			/// @throws std::out_of_range as above.
+			void quantize(const Eigen::Matrix4d * poses, QuantizedPose * out, std::size_t n) const {
+				for (std::size_t i = 0; i < n; ++i) {
+					out[i] = quantize(poses[i]);
+				}
+			}
+
+			/// Recover the position and (normalized) rotation of a quantized pose.
+			void dequantize(QuantizedPose const& q, Eigen::Vector3d & position, Eigen::Quaterniond & rotation) const {
+				double lanes[4];
+				_dequantize(q, lanes, rotation);
+				position = Eigen::Vector3d(lanes[0], lanes[1], lanes[2]);
+			}
+
+			/// Recover a rigid transformation matrix from a quantized pose.
+			Eigen::Matrix4d dequantize(QuantizedPose const& q) const {
+				Eigen::Matrix4d pose;
+				_dequantizeInto(q, pose);
+				return pose;
+			}
+
+			/// Recover n rigid transformation matrices.
+			void dequantize(const QuantizedPose * in, Eigen::Matrix4d * poses, std::size_t n) const {
+				for (std::size_t i = 0; i < n; ++i) {
+					_dequantizeInto(in[i], poses[i]);
+				}
+			}
+
+		private:
+			QuantizedPose _quantize(const double * positionLanes, Eigen::Quaterniond const& rotation) const {
+				QuantizedPose ret;
+				stdint::int32_t lanes[4];
+				if (!detail::quantizeLanes(positionLanes, _positionScale, lanes)) {
+					throw std::out_of_range("Position out of range for pose quantization");
+				}
+				for (int i = 0; i < 3; ++i) {
+					ret.position[i] = lanes[i];
+				}
+
+				const Eigen::Vector4d coeffs = rotation.normalized().coeffs();
+				int largest = 0;
+				for (int i = 1; i < 4; ++i) {
+					if (std::fabs(coeffs[i]) > std::fabs(coeffs[largest])) {
+						largest = i;
+					}
+				}
+				/// q and -q are the same rotation: pick the one with a positive largest component.
+				const double sign = coeffs[largest] < 0 ? -1.0 : 1.0;
+				double smallest[4] = {0, 0, 0, 0};
+				for (int i = 0, j = 0; i < 4; ++i) {
+					if (i != largest) {
+						smallest[j++] = sign * coeffs[i];
+					}
+				}
+				if (!detail::quantizeLanes(smallest, _rotationScale, lanes)) {
+					throw std::out_of_range("Rotation is not a finite quaternion");
+				}
+				for (int i = 0; i < 3; ++i) {
+					ret.rotation[i] = lanes[i];
+				}
+				ret.largest = static_cast<stdint::uint8_t>(largest);
+				return ret;
+			}
+
+			void _dequantize(QuantizedPose const& q, double * positionLanes, Eigen::Quaterniond & rotation) const {
+				const stdint::int32_t position[4] = {q.position[0], q.position[1], q.position[2], 0};
+				detail::dequantizeLanes(position, _positionStep, positionLanes);
+
+				const stdint::int32_t smallestQ[4] = {q.rotation[0], q.rotation[1], q.rotation[2], 0};
+				double smallest[4];
+				detail::dequantizeLanes(smallestQ, _rotationStep, smallest);
+				const double sumSquares = smallest[0] * smallest[0] + smallest[1] * smallest[1] + smallest[2] * smallest[2];
+				Eigen::Vector4d coeffs;
+				for (int i = 0, j = 0; i < 4; ++i) {
+					coeffs[i] = (i == (q.largest & 3)) ? std::sqrt(std::max(0.0, 1.0 - sumSquares)) : smallest[j++];
+				}
+				rotation.coeffs() = coeffs.normalized();
+			}
+
+			void _dequantizeInto(QuantizedPose const& q, Eigen::Matrix4d & pose) const {
+				Eigen::Quaterniond rotation;
+				double lanes[4];
+				_dequantize(q, lanes, rotation);
+				pose.topLeftCorner<3, 3>() = rotation.toRotationMatrix();
+				pose.col(3) << lanes[0], lanes[1], lanes[2], 1.0;
+				pose.row(3).head<3>().setZero();
+			}
+
+			double _positionStep;
+			double _positionScale;
+			double _rotationStep;
+			double _rotationScale;
+			unsigned int _rotationBits;
+	};
+
+	/** @brief Write a quantized pose as a difference from a baseline pose
+		the receiver also has (typically the last one it acknowledged).
+
+		@param out Buffer with room for at least POSE_DELTA_MAX_BYTES.
+		@returns the number of bytes written.
+	*/
+	inline std::size_t encodePoseDelta(unsigned char * out, QuantizedPose const& pose, QuantizedPose const& baseline) {
+		/// Rotation components are only comparable if the same one was dropped.
+		const bool rotationDelta = pose.largest == baseline.largest;
+		out[0] = static_cast<unsigned char>((pose.largest & 3) | (rotationDelta ? 4 : 0));
+		std::size_t n = 1;
+		for (int i = 0; i < 3; ++i) {
+			n += detail::poseWriteVarint(out + n, detail::poseZigZag(pose.position[i] - baseline.position[i]));
+		}
+		for (int i = 0; i < 3; ++i) {
+			n += detail::poseWriteVarint(out + n, detail::poseZigZag(pose.rotation[i] - (rotationDelta ? baseline.rotation[i] : 0)));
+		}
+		return n;
+	}
+
+	/** @brief Read a pose written by encodePoseDelta() against the same
+		baseline.
+
+		@returns the number of bytes consumed, or 0 if the input is
+		incomplete (in which case pose is unspecified).
+		@throws std::runtime_error if the input is malformed.
+	*/
+	inline std::size_t decodePoseDelta(const unsigned char * in, std::size_t available, QuantizedPose const& baseline, QuantizedPose & pose) {
+		if (available == 0) {
+			return 0;
+		}
+		if (in[0] & 0xf8) {
+			throw std::runtime_error("Malformed pose encoding: unknown flags");
+		}
+		pose.largest = static_cast<stdint::uint8_t>(in[0] & 3);
+		const bool rotationDelta = (in[0] & 4) != 0;
+		std::size_t n = 1;
+		for (int i = 0; i < 6; ++i) {
+			stdint::uint32_t v;
+			const std::size_t consumed = detail::poseReadVarint(in + n, available - n, v);
+			if (consumed == 0) {
+				return 0;
+			}
+			n += consumed;
+			if (i < 3) {
+				pose.position[i] = detail::poseApplyDelta(baseline.position[i], detail::poseUnZigZag(v));
+			} else {
+				pose.rotation[i - 3] = detail::poseApplyDelta(rotationDelta ? baseline.rotation[i - 3] : 0, detail::poseUnZigZag(v));
+			}
+		}
+		return n;
+	}
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_EigenPoseQuantize_h_GUID_36b56a2a_bd2a_4f1e_8290_73f9d581ba8d
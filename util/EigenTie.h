@@ -1,11 +1,22 @@
 /** @file
 	@brief Header
 
+	Element access for ties of up to four variables is unrolled at compile
+	time. Ties of separate variables always go through their pointers,
+	even when the variables happen to be adjacent. For data known to be
+	contiguous, util::TieVector<Dim>(pointer) and util::TieVector(array)
+	return an Eigen::Map instead, so assignment is a plain vector store.
+
+	util::TieColumns() ties the same position in several separate arrays,
+	so structure-of-arrays data can be read and written with Eigen math one
+	element at a time or in bulk.
+
 	Define UTIL_EIGEN_TIE_UNIQUE_ASSIGN_ASSERT or UTIL_EIGEN_TIE_UNIQUE_ASSIGN_EXCEPTION
 	to enable a debug-mode run-time	check that all tied variables are unique
-	when a tie is assigned to. This is fairly computationally expensive.
-	(std::set construction from iterators used to count unique pointers,
-	n log n for a tie of dimension n)
+	when a tie is assigned to. The tied pointers are counted once, when the
+	tie is constructed, by sorting a copy on the stack (with a fixed sorting
+	network for ties of up to four variables), so the cost per assignment
+	is a single comparison.
 
 	@date 2011
 
@@ -33,12 +44,26 @@
 
 // Library/third-party includes
 #include <Eigen/Core>
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
+#include <boost/static_assert.hpp>
 
 // Standard includes
-// - none
+#include <cstddef>
+#include <cassert>
+#include <algorithm>
+#include <functional>
+
+#ifndef UTIL_EIGEN_TIE_MAX_ARITY
+/// Largest number of arguments accepted by util::TieVector() and
+/// util::TieColumns(): define before including to change. Larger ties can
+/// still be built with the chained TieVector(x)(y)... syntax.
+#	define UTIL_EIGEN_TIE_MAX_ARITY 10
+#endif
 #if (defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_ASSERT) || defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_EXCEPTION)) && !defined(NDEBUG)
 #	define UTIL_EIGEN_TIE_UNIQUE_ASSIGN_DO_CHECK
-#	include <set>
 namespace util {
 	namespace {
 		/// Utility function used when one of the unique assign checks is enabled.
@@ -58,6 +83,142 @@ namespace util {
 		template<int _Dim, typename _Scalar>
 		class TieVector;
 
+		// forward declaration
+		template<int _Dim, typename _Scalar>
+		class ColumnTie;
+
+		/// Ties up to this dimension get fully unrolled element access.
+		enum {
+			TIE_UNROLL_LIMIT = 4
+		};
+
+		/// @internal
+		/// @brief Compile-time unrolled access through an array of pointers,
+		/// one element per recursion step.
+		template<int Index, int Dim>
+		struct TieUnroller {
+			template<typename Scalar, typename Source>
+			static EIGEN_STRONG_INLINE void scatter(Scalar * const * data, Source const& src) {
+				*(data[Index]) = src.coeff(Index);
+				TieUnroller < Index + 1, Dim >::scatter(data, src);
+			}
+
+			template<typename Scalar, typename Dest>
+			static EIGEN_STRONG_INLINE void gather(Scalar * const * data, Dest & dest) {
+				dest.coeffRef(Index) = *(data[Index]);
+				TieUnroller < Index + 1, Dim >::gather(data, dest);
+			}
+		};
+
+		/// @internal
+		/// @brief Termination of the unrolled recursion.
+		template<int Dim>
+		struct TieUnroller<Dim, Dim> {
+			template<typename Scalar, typename Source>
+			static EIGEN_STRONG_INLINE void scatter(Scalar * const *, Source const&) {}
+
+			template<typename Scalar, typename Dest>
+			static EIGEN_STRONG_INLINE void gather(Scalar * const *, Dest &) {}
+		};
+
+		/// @internal
+		/// @brief Run-time loop equivalent of TieUnroller, for larger ties.
+		template<int Dim>
+		struct TieLooper {
+			template<typename Scalar, typename Source>
+			static EIGEN_STRONG_INLINE void scatter(Scalar * const * data, Source const& src) {
+				for (int i = 0; i < Dim; ++i) {
+					*(data[i]) = src.coeff(i);
+				}
+			}
+
+			template<typename Scalar, typename Dest>
+			static EIGEN_STRONG_INLINE void gather(Scalar * const * data, Dest & dest) {
+				for (int i = 0; i < Dim; ++i) {
+					dest.coeffRef(i) = *(data[i]);
+				}
+			}
+		};
+
+		/// @internal
+		/// @brief Sorts Dim pointers in place: a fixed network of
+		/// compare-exchanges for small ties, std::sort otherwise.
+		template<int Dim>
+		struct TieSortingNetwork {
+			template<typename T>
+			static void sort(T * p) {
+				std::sort(p, p + Dim, std::less<T>());
+			}
+		};
+
+		/// @internal
+		template<typename T>
+		EIGEN_STRONG_INLINE void tieCompareExchange(T & a, T & b) {
+			if (std::less<T>()(b, a)) {
+				std::swap(a, b);
+			}
+		}
+
+		template<>
+		struct TieSortingNetwork<1> {
+			template<typename T>
+			static void sort(T *) {}
+		};
+
+		template<>
+		struct TieSortingNetwork<2> {
+			template<typename T>
+			static EIGEN_STRONG_INLINE void sort(T * p) {
+				tieCompareExchange(p[0], p[1]);
+			}
+		};
+
+		template<>
+		struct TieSortingNetwork<3> {
+			template<typename T>
+			static EIGEN_STRONG_INLINE void sort(T * p) {
+				tieCompareExchange(p[1], p[2]);
+				tieCompareExchange(p[0], p[2]);
+				tieCompareExchange(p[0], p[1]);
+			}
+		};
+
+		template<>
+		struct TieSortingNetwork<4> {
+			template<typename T>
+			static EIGEN_STRONG_INLINE void sort(T * p) {
+				tieCompareExchange(p[0], p[1]);
+				tieCompareExchange(p[2], p[3]);
+				tieCompareExchange(p[0], p[2]);
+				tieCompareExchange(p[1], p[3]);
+				tieCompareExchange(p[1], p[2]);
+			}
+		};
+
+		/// @internal
+		/// @brief Number of distinct pointers among the Dim in data, without
+		/// allocating.
+		template<int Dim, typename Scalar>
+		EIGEN_STRONG_INLINE int tieCountUnique(Scalar * const * data) {
+			Scalar * sorted[Dim];
+			std::copy(data, data + Dim, sorted);
+			TieSortingNetwork<Dim>::sort(sorted);
+			int unique = 1;
+			for (int i = 1; i < Dim; ++i) {
+				if (sorted[i] != sorted[i - 1]) {
+					++unique;
+				}
+			}
+			return unique;
+		}
+
+		/// @internal
+		/// @brief Selects unrolled or looped element access for a tie dimension.
+		template<int Dim>
+		struct TieAccess {
+			typedef typename Eigen::internal::conditional < (Dim <= TIE_UNROLL_LIMIT), TieUnroller<0, Dim>, TieLooper<Dim> >::type type;
+		};
+
 		// forward declaration
 		template<int _Dim, typename _Scalar1, typename _Scalar2>
 		bool operator==(TieVector<_Dim, _Scalar1> const& lhs, TieVector<_Dim, _Scalar2> const& rhs);
@@ -74,21 +235,34 @@ namespace util {
 				};
 				typedef Eigen::Matrix<_Scalar, _Dim, 1> Base;
 			private:
+				typedef typename TieAccess<Dim>::type Access;
+
 				Scalar * _data[Dim];
 
+#if defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_DO_CHECK)
+				/// Number of distinct variables tied, counted at construction.
+				int _uniqueElements;
+#endif
+
+				/// Internal method called by each constructor once _data is filled.
+				EIGEN_STRONG_INLINE void _init() {
+#if defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_DO_CHECK)
+					_uniqueElements = tieCountUnique<Dim>(_data);
+#endif
+				}
+
 				/// Internal method used for setting a tie vector from an eigen vector
 				template<typename OtherDerived>
 				EIGEN_STRONG_INLINE TieVector & _set(::Eigen::MatrixBase<OtherDerived> const& other) {
 					EIGEN_STATIC_ASSERT_VECTOR_SPECIFIC_SIZE(OtherDerived, int(Dim));
 
 #if defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_DO_CHECK)
-					std::set<Scalar *> uniqueElements(_data, _data + Dim);
-					checkSameDimensions(static_cast<int>(uniqueElements.size()), Dim);
+					checkSameDimensions(_uniqueElements, Dim);
 #endif
 
-					for (int i = 0; i < Dim; ++i) {
-						*(_data[i]) = other[i];
-					}
+					/// Evaluates expensive expressions (like products) once, leaves the rest lazy.
+					typename ::Eigen::internal::nested<OtherDerived>::type source(other.derived());
+					Access::scatter(_data, source);
 					return *this;
 				}
 
@@ -101,39 +275,34 @@ namespace util {
 						_data[i] = prev._data[i];
 					}
 					_data[Dim - 1] = &newVal;
+					_init();
 				}
 
-			public:
-#define EIGEN_TIE_STATIC_ASSERT_DIMENSION(_NUMARGS) assert(Dim == _NUMARGS && "YOU_DID_NOT_PASS_THE_CORRECT_AMOUNT_OF_ARGUMENTS_TO_TIE_TOGETHER")
-//#define EIGEN_TIE_STATIC_ASSERT_DIMENSION(_NUMARGS) EIGEN_STATIC_ASSERT( (int(Dim) == int(_NUMARGS)), YOU_DID_NOT_PASS_THE_CORRECT_AMOUNT_OF_ARGUMENTS_TO_TIE_TOGETHER)
-#define EIGEN_TIE_INITIALIZE_ELEMENT(_ELT) _data[_ELT] = &x ## _ELT
-
-				TieVector(Scalar & x0) {
-					EIGEN_TIE_STATIC_ASSERT_DIMENSION(1);
-					EIGEN_TIE_INITIALIZE_ELEMENT(0);
-				}
+				template<int _D, typename _S>
+				friend class ColumnTie;
 
-				TieVector(Scalar & x0, Scalar & x1) {
-					EIGEN_TIE_STATIC_ASSERT_DIMENSION(2);
-					EIGEN_TIE_INITIALIZE_ELEMENT(0);
-					EIGEN_TIE_INITIALIZE_ELEMENT(1);
+				/// Private constructor used by ColumnTie
+				explicit TieVector(Scalar * const * data) {
+					for (int i = 0; i < Dim; ++i) {
+						_data[i] = data[i];
+					}
+					_init();
 				}
 
-				TieVector(Scalar & x0, Scalar & x1, Scalar & x2) {
-					EIGEN_TIE_STATIC_ASSERT_DIMENSION(3);
-					EIGEN_TIE_INITIALIZE_ELEMENT(0);
-					EIGEN_TIE_INITIALIZE_ELEMENT(1);
-					EIGEN_TIE_INITIALIZE_ELEMENT(2);
+			public:
+#define EIGEN_TIE_STATIC_ASSERT_DIMENSION(_NUMARGS) assert(Dim == _NUMARGS && "YOU_DID_NOT_PASS_THE_CORRECT_AMOUNT_OF_ARGUMENTS_TO_TIE_TOGETHER")
+//#define EIGEN_TIE_STATIC_ASSERT_DIMENSION(_NUMARGS) EIGEN_STATIC_ASSERT( (int(Dim) == int(_NUMARGS)), YOU_DID_NOT_PASS_THE_CORRECT_AMOUNT_OF_ARGUMENTS_TO_TIE_TOGETHER)
+#define EIGEN_TIE_INITIALIZE_ELEMENT(_Z, _ELT, _UNUSED) _data[_ELT] = &x ## _ELT;
+#define EIGEN_TIE_DEFINE_CONSTRUCTOR(_Z, _NUMARGS, _UNUSED) \
+				TieVector(BOOST_PP_ENUM_PARAMS(_NUMARGS, Scalar & x)) { \
+					EIGEN_TIE_STATIC_ASSERT_DIMENSION(_NUMARGS); \
+					BOOST_PP_REPEAT(_NUMARGS, EIGEN_TIE_INITIALIZE_ELEMENT, ~) \
+					_init(); \
 				}
 
-				TieVector(Scalar & x0, Scalar & x1, Scalar & x2, Scalar & x3) {
-					EIGEN_TIE_STATIC_ASSERT_DIMENSION(4);
-					EIGEN_TIE_INITIALIZE_ELEMENT(0);
-					EIGEN_TIE_INITIALIZE_ELEMENT(1);
-					EIGEN_TIE_INITIALIZE_ELEMENT(2);
-					EIGEN_TIE_INITIALIZE_ELEMENT(3);
-				}
+				BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(UTIL_EIGEN_TIE_MAX_ARITY), EIGEN_TIE_DEFINE_CONSTRUCTOR, ~)
 
+#undef EIGEN_TIE_DEFINE_CONSTRUCTOR
 #undef EIGEN_TIE_INITIALIZE_ELEMENT
 #undef EIGEN_TIE_STATIC_ASSERT_DIMENSION
 
@@ -158,9 +327,7 @@ namespace util {
 				/// Returns a copy of the TieVector current value as a fixed-size Eigen::Vector
 				EIGEN_STRONG_INLINE Base convert() const {
 					Base temp;
-					for (int i = 0; i < Dim; ++i) {
-						temp[i] = *(_data[i]);
-					}
+					Access::gather(_data, temp);
 					return temp;
 				}
 
@@ -236,35 +403,112 @@ namespace util {
 			return !(tieVal == other);
 		}
 
+		/** @brief Ties element i of each of Dim separate arrays together, so
+			structure-of-arrays storage can be used with Eigen math.
+
+			Construct these using util::TieColumns(). Indexing gives a
+			TieVector of the elements at one position; assigning a matrix with
+			Dim rows writes its columns to consecutive positions. Ranges
+			are not checked: each array must have room for every position used.
+		*/
+		template<int _Dim, typename _Scalar>
+		class ColumnTie {
+			public:
+				typedef _Scalar Scalar;
+				enum {
+					Dim = _Dim
+				};
+				typedef TieVector<_Dim, _Scalar> value_type;
+				typedef Eigen::Matrix<_Scalar, _Dim, Eigen::Dynamic> PlainMatrix;
+				typedef Eigen::Map<Eigen::Matrix<_Scalar, 1, Eigen::Dynamic> > RowMap;
+
+				explicit ColumnTie(Scalar * const * columns) {
+					for (int d = 0; d < Dim; ++d) {
+						_columns[d] = columns[d];
+					}
+#if defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_DO_CHECK)
+					_uniqueColumns = tieCountUnique<Dim>(_columns);
+#endif
+				}
+
+				/// Tie of the elements at position i
+				EIGEN_STRONG_INLINE value_type operator[](std::size_t i) const {
+					Scalar * data[Dim];
+					for (int d = 0; d < Dim; ++d) {
+						data[d] = _columns[d] + i;
+					}
+					return value_type(data);
+				}
+
+				/// The array for dimension d, as an Eigen row vector of n elements
+				EIGEN_STRONG_INLINE RowMap row(int d, std::size_t n) const {
+					return RowMap(_columns[d], n);
+				}
+
+				/// Write the columns of other to positions 0 through other.cols() - 1.
+				/// Each array is written in one contiguous pass.
+				template<typename OtherDerived>
+				ColumnTie & operator=(::Eigen::MatrixBase<OtherDerived> const& other) {
+					BOOST_STATIC_ASSERT_MSG((int(OtherDerived::RowsAtCompileTime) == int(Dim) || int(OtherDerived::RowsAtCompileTime) == int(::Eigen::Dynamic)),
+					                        "YOU_MIXED_MATRICES_OF_DIFFERENT_SIZES");
+					eigen_assert(other.rows() == Dim && "Assigning a matrix with the wrong number of rows to a column tie");
+#if defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_DO_CHECK)
+					checkSameDimensions(_uniqueColumns, Dim);
+#endif
+					/// Evaluates expensive expressions (like products) once, since each row is read separately.
+					typename ::Eigen::internal::nested<OtherDerived, Dim>::type source(other.derived());
+					for (int d = 0; d < Dim; ++d) {
+						row(d, source.cols()) = source.row(d).template cast<Scalar>();
+					}
+					return *this;
+				}
+
+				/// Copy positions 0 through n - 1 into a matrix, one column per position.
+				PlainMatrix convert(std::size_t n) const {
+					PlainMatrix ret(int(Dim), n);
+					for (int d = 0; d < Dim; ++d) {
+						ret.row(d) = row(d, n);
+					}
+					return ret;
+				}
+
+			private:
+				Scalar * _columns[Dim];
+#if defined(UTIL_EIGEN_TIE_UNIQUE_ASSIGN_DO_CHECK)
+				int _uniqueColumns;
+#endif
+		};
+
 	} // end of namespace detail
 
-#define EIGEN_TIE_DEFINE_CREATION_FUNCTION( _DIM, _ARGS, _ARGNAMES) \
+#define EIGEN_TIE_DEFINE_CREATION_FUNCTION(_Z, _DIM, _UNUSED) \
 	template<typename Scalar> \
-	EIGEN_STRONG_INLINE detail::TieVector<_DIM, Scalar> TieVector _ARGS { \
-		return detail::TieVector<_DIM, Scalar> _ARGNAMES ; \
+	EIGEN_STRONG_INLINE detail::TieVector<_DIM, Scalar> TieVector(BOOST_PP_ENUM_PARAMS(_DIM, Scalar & x)) { \
+		return detail::TieVector<_DIM, Scalar>(BOOST_PP_ENUM_PARAMS(_DIM, x)); \
 	} \
- 
-	EIGEN_TIE_DEFINE_CREATION_FUNCTION(1,
-	                                   (Scalar & x0),
-	                                   (x0)
-	                                  )
-
-	EIGEN_TIE_DEFINE_CREATION_FUNCTION(2,
-	                                   (Scalar & x0, Scalar & x1),
-	                                   (x0, x1)
-	                                  )
-
-	EIGEN_TIE_DEFINE_CREATION_FUNCTION(3,
-	                                   (Scalar & x0, Scalar & x1, Scalar & x2),
-	                                   (x0, x1, x2)
-	                                  )
-
-	EIGEN_TIE_DEFINE_CREATION_FUNCTION(4,
-	                                   (Scalar & x0, Scalar & x1, Scalar & x2, Scalar & x3),
-	                                   (x0, x1, x2, x3)
-	                                  )
+	/** @brief Ties element i of separate arrays together: see detail::ColumnTie */ \
+	template<typename Scalar> \
+	EIGEN_STRONG_INLINE detail::ColumnTie<_DIM, Scalar> TieColumns(BOOST_PP_ENUM_PARAMS(_DIM, Scalar * x)) { \
+		Scalar * columns[_DIM] = {BOOST_PP_ENUM_PARAMS(_DIM, x)}; \
+		return detail::ColumnTie<_DIM, Scalar>(columns); \
+	}
+
+	BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(UTIL_EIGEN_TIE_MAX_ARITY), EIGEN_TIE_DEFINE_CREATION_FUNCTION, ~)
 
 #undef EIGEN_TIE_DEFINE_CREATION_FUNCTION
+
+	/// @brief Ties Dim contiguous values starting at data, as an Eigen::Map:
+	/// call as util::TieVector<3>(&values[i]).
+	template<int Dim, typename Scalar>
+	EIGEN_STRONG_INLINE ::Eigen::Map< ::Eigen::Matrix<Scalar, Dim, 1> > TieVector(Scalar * data) {
+		return ::Eigen::Map< ::Eigen::Matrix<Scalar, Dim, 1> >(data);
+	}
+
+	/// @brief Ties all the elements of an array, as an Eigen::Map.
+	template<typename Scalar, int Dim>
+	EIGEN_STRONG_INLINE ::Eigen::Map< ::Eigen::Matrix<Scalar, Dim, 1> > TieVector(Scalar (&data)[Dim]) {
+		return ::Eigen::Map< ::Eigen::Matrix<Scalar, Dim, 1> >(data);
+	}
 /// @}
 
 } // end of namespace util
@@ -0,0 +1,287 @@
+/** @file
+	@brief Flat, sorted, bulk-built set of Set2 values with adjacency
+	lookup - a cache-friendly replacement for std::map keyed by mesh edges.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_FlatSet2_h_GUID_e801bffe_b063_446e_8011_e19227ce5d34
+#define INCLUDED_FlatSet2_h_GUID_e801bffe_b063_446e_8011_e19227ce5d34
+
+// Internal Includes
+#include <util/Set2.h>
+#include <util/RadixSort.h>
+
+// Library/third-party includes
+#include <boost/static_assert.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <cstddef>
+
+namespace util {
+
+	namespace detail {
+		/// @internal
+		/// @brief Functor turning a packed key back into its Set2
+		template<typename T>
+		struct Set2FromKey {
+			typedef Set2<T> result_type;
+			result_type operator()(typename PackedSet2<T>::key_type k) const {
+				return PackedSet2<T>::fromKey(k).unpacked();
+			}
+		};
+	} // end of namespace detail
+
+/// @addtogroup DataStructures Data Structures
+/// @{
+
+	/** @brief An immutable, flat set of unique Set2<T> values (e.g. the
+		undirected edges of a mesh), built in bulk.
+
+		Construction radix-sorts the packed keys of the input and removes
+		duplicates. Each unique value is then identified by its index in
+		sorted order (its ID), which can be used to index parallel arrays in
+		place of a map's mapped values.
+
+		find() looks values up in an open-addressing hash index of the
+		packed keys, kept at most half full, so it takes expected constant
+		time whatever the element values.
+
+		Adjacency is also indexed: element values are treated as vertex
+		indices in 0, 1, ..., vertexCount() - 1, so they must not be
+		negative. The per-vertex offset tables have vertexCount() + 1
+		entries, one more than the largest element, so the indices should
+		be dense: a single huge or sparse index allocates tables that size.
+		edgesFrom()/edgesTo() then take constant time.
+
+		@tparam T A type PackedSet2 can hold: values are stored as packed keys.
+	*/
+	template<typename T>
+	class FlatSet2 {
+		public:
+			typedef Set2<T> value_type;
+			typedef typename PackedSet2<T>::key_type key_type;
+			typedef std::size_t id_type;
+			typedef std::size_t size_type;
+			typedef boost::transform_iterator<detail::Set2FromKey<T>, typename std::vector<key_type>::const_iterator> const_iterator;
+			typedef const_iterator iterator;
+
+			/// Range of IDs for the edges whose first() is a given vertex:
+			/// these IDs are consecutive.
+			typedef std::pair<id_type, id_type> id_range;
+
+			/// Range of IDs for the edges whose second() is a given vertex.
+			typedef std::pair<id_type const*, id_type const*> id_list;
+
+			BOOST_STATIC_ASSERT_MSG(detail::Set2IsPackable<T>::value, "FlatSet2 requires a type PackedSet2 can hold");
+
+			/// Default constructor: an empty set
+			FlatSet2() {
+				_firstOffsets.push_back(0);
+				_secondOffsets.push_back(0);
+			}
+
+			/// Construct from a range of Set2<T> values, possibly with duplicates.
+			/// @throws std::out_of_range if any element is negative
+			template<typename InputIterator>
+			FlatSet2(InputIterator first, InputIterator last) {
+				assign(first, last);
+			}
+
+			/// Replace the contents with the unique values of a range of Set2<T>.
+			/// @throws std::out_of_range if any element is negative
+			template<typename InputIterator>
+			void assign(InputIterator first, InputIterator last) {
+				_keys.clear();
+				for (; first != last; ++first) {
+					_keys.push_back(PackedSet2<T>(value_type(*first)).key());
+				}
+				_build();
+			}
+
+			/// Number of unique values
+			size_type size() const {
+				return _keys.size();
+			}
+
+			bool empty() const {
+				return _keys.empty();
+			}
+
+			/// One more than the largest element value in the set
+			size_type vertexCount() const {
+				return _firstOffsets.size() - 1;
+			}
+
+			/// Value with the given ID
+			value_type operator[](id_type id) const {
+				return detail::Set2FromKey<T>()(_keys[id]);
+			}
+
+			/// Iterator over values in sorted (ID) order
+			const_iterator begin() const {
+				return const_iterator(_keys.begin(), detail::Set2FromKey<T>());
+			}
+
+			const_iterator end() const {
+				return const_iterator(_keys.end(), detail::Set2FromKey<T>());
+			}
+
+			/// Find the ID of a value, in expected constant time.
+			/// @returns the ID, or size() if the value is not present.
+			id_type find(value_type const& v) const {
+				if (_index.empty()) {
+					return size();
+				}
+				const key_type k = PackedSet2<T>(v).key();
+				const std::size_t mask = _index.size() - 1;
+				/// The index is at most half full, so probing ends at an empty slot
+				for (std::size_t slot = detail::set2MixKey(k) & mask; _index[slot] != 0; slot = (slot + 1) & mask) {
+					const id_type id = _index[slot] - 1;
+					if (_keys[id] == k) {
+						return id;
+					}
+				}
+				return size();
+			}
+
+			/// Whether a value is present
+			bool contains(value_type const& v) const {
+				return find(v) != size();
+			}
+
+			/// IDs of the edges whose smaller element is vertex v
+			id_range edgesFrom(T v) const {
+				const std::size_t a = _vertexIndex(v);
+				if (a >= vertexCount()) {
+					return id_range(size(), size());
+				}
+				return id_range(_firstOffsets[a], _firstOffsets[a + 1]);
+			}
+
+			/// IDs of the edges whose larger element is vertex v
+			id_list edgesTo(T v) const {
+				const std::size_t a = _vertexIndex(v);
+				if (a >= vertexCount() || _secondIDs.empty()) {
+					return id_list(NULL, NULL);
+				}
+				id_type const* base = &_secondIDs[0];
+				return id_list(base + _secondOffsets[a], base + _secondOffsets[a + 1]);
+			}
+
+			/// Number of edges that include vertex v
+			size_type degree(T v) const {
+				const id_range from = edgesFrom(v);
+				const id_list to = edgesTo(v);
+				return (from.second - from.first) + (to.second - to.first);
+			}
+
+			/// Call f(neighbor, edgeID) for every edge including vertex v:
+			/// first edges for which v is the larger element, then those for
+			/// which it is the smaller, each in increasing neighbor order.
+			template<typename Functor>
+			void forEachNeighbor(T v, Functor f) const {
+				const id_list to = edgesTo(v);
+				for (id_type const* it = to.first; it != to.second; ++it) {
+					f((*this)[*it].first(), *it);
+				}
+				const id_range from = edgesFrom(v);
+				for (id_type id = from.first; id != from.second; ++id) {
+					f((*this)[id].second(), id);
+				}
+			}
+
+		private:
+			static std::size_t _vertexIndex(T v) {
+				return static_cast<std::size_t>(v);
+			}
+
+			/// Compares in the packed, order-preserving representation to
+			/// avoid a tautological comparison for unsigned types.
+			static bool _isNegative(T v) {
+				typedef detail::Set2OrderedBits<T> bits;
+				return bits::to(v) < bits::to(T(0));
+			}
+
+			void _build() {
+				radixSort(_keys);
+				_keys.erase(std::unique(_keys.begin(), _keys.end()), _keys.end());
+
+				const size_type n = _keys.size();
+				if (n > 0 && _isNegative((*this)[0].first())) {
+					/// Keys are sorted, so the first one holds the smallest element.
+					throw std::out_of_range("FlatSet2 elements are vertex indices and must not be negative!");
+				}
+				size_type vertices = 0;
+				for (size_type i = 0; i < n; ++i) {
+					vertices = std::max(vertices, _vertexIndex((*this)[i].second()) + 1);
+				}
+
+				/// Keys are sorted by first(), so edges from each vertex are
+				/// a contiguous run: a counting pass gives the offsets.
+				_firstOffsets.assign(vertices + 1, 0);
+				_secondOffsets.assign(vertices + 1, 0);
+				for (size_type i = 0; i < n; ++i) {
+					const value_type e = (*this)[i];
+					++_firstOffsets[_vertexIndex(e.first()) + 1];
+					++_secondOffsets[_vertexIndex(e.second()) + 1];
+				}
+				for (size_type v = 0; v < vertices; ++v) {
+					_firstOffsets[v + 1] += _firstOffsets[v];
+					_secondOffsets[v + 1] += _secondOffsets[v];
+				}
+
+				/// Scattering in ID order leaves each vertex's list sorted by first().
+				_secondIDs.resize(n);
+				std::vector<size_type> cursor(_secondOffsets.begin(), _secondOffsets.end() - 1);
+				for (size_type i = 0; i < n; ++i) {
+					_secondIDs[cursor[_vertexIndex((*this)[i].second())]++] = i;
+				}
+
+				/// Slots hold ID + 1, so that 0 can mark an empty slot.
+				size_type slots = n ? 2 : 0;
+				while (slots < 2 * n) {
+					slots <<= 1;
+				}
+				_index.assign(slots, 0);
+				for (size_type i = 0; i < n; ++i) {
+					std::size_t slot = detail::set2MixKey(_keys[i]) & (slots - 1);
+					while (_index[slot] != 0) {
+						slot = (slot + 1) & (slots - 1);
+					}
+					_index[slot] = i + 1;
+				}
+			}
+
+			std::vector<key_type> _keys;
+			std::vector<size_type> _firstOffsets;
+			std::vector<size_type> _secondOffsets;
+			std::vector<id_type> _secondIDs;
+			std::vector<id_type> _index;
+	};
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_FlatSet2_h_GUID_e801bffe_b063_446e_8011_e19227ce5d34
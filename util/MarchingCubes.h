@@ -0,0 +1,755 @@
+/** @file
+	@brief Header providing a marching cubes isosurface extractor for dense
+	scalar grids.
+
+	Cells are classified against the isovalue eight corners at a time with
+	SIMD compares, and the surface in each cell comes from a case table
+	expressed in the vertex and edge IDs of CubeComponents. The grid is cut
+	into slabs of cell layers that are extracted independently (optionally
+	in parallel); within a slab, each surface vertex is computed once and
+	shared through caches of the edges on the two current grid planes.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_MarchingCubes_h_GUID_47e71d35_27de_4490_bc40_e7da563936d0
+#define INCLUDED_MarchingCubes_h_GUID_47e71d35_27de_4490_bc40_e7da563936d0
+
+// Internal Includes
+#include <util/CubeComponents.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+#include <boost/thread/thread.hpp>
+
+// Standard includes
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTIL_MARCHINGCUBES_SSE2
+#endif
+
+namespace util {
+
+	/// @addtogroup Math Math Utilities
+	/// @{
+
+	/** @brief Marching cubes case tables.
+
+		A case is the 8-bit set of cube corners (using Cube::Vertex IDs) whose
+		value is below the isovalue. Edges are Cube::Edge IDs (see CubeTables).
+
+		The tables are generated by walking the surface across the cube
+		faces, so they depend only on face sign patterns: on a face with two
+		diagonal corners below the isovalue, those corners are always kept
+		apart. That makes neighboring cells agree on every shared face, so
+		extracted surfaces have no cracks. Each polygon is then triangulated
+		without diagonals between two edges of the same face (a fan when one
+		fits, otherwise a recursive split), so no triangle lies in a cube face,
+		where it could meet the neighboring cell's surface a second time.
+		Triangles wind counter-clockwise when seen from the side above the
+		isovalue.
+	*/
+	template<typename Dummy = void>
+	struct MarchingCubesTablesT {
+		/// edgeMask[c]: bit e is set if edge e crosses the surface in case c
+		static const stdint::uint16_t edgeMask[256];
+		/// triangles[c]: edge IDs, three per triangle, terminated by -1
+		static const signed char triangles[256][16];
+	};
+
+	template<typename Dummy>
+	const stdint::uint16_t MarchingCubesTablesT<Dummy>::edgeMask[256] = {
+		0x000, 0x111, 0x221, 0x330, 0x412, 0x503, 0x633, 0x722,
+		0x822, 0x933, 0xa03, 0xb12, 0xc30, 0xd21, 0xe11, 0xf00,
+		0x144, 0x055, 0x365, 0x274, 0x556, 0x447, 0x777, 0x666,
+		0x966, 0x877, 0xb47, 0xa56, 0xd74, 0xc65, 0xf55, 0xe44,
+		0x284, 0x395, 0x0a5, 0x1b4, 0x696, 0x787, 0x4b7, 0x5a6,
+		0xaa6, 0xbb7, 0x887, 0x996, 0xeb4, 0xfa5, 0xc95, 0xd84,
+		0x3c0, 0x2d1, 0x1e1, 0x0f0, 0x7d2, 0x6c3, 0x5f3, 0x4e2,
+		0xbe2, 0xaf3, 0x9c3, 0x8d2, 0xff0, 0xee1, 0xdd1, 0xcc0,
+		0x448, 0x559, 0x669, 0x778, 0x05a, 0x14b, 0x27b, 0x36a,
+		0xc6a, 0xd7b, 0xe4b, 0xf5a, 0x878, 0x969, 0xa59, 0xb48,
+		0x50c, 0x41d, 0x72d, 0x63c, 0x11e, 0x00f, 0x33f, 0x22e,
+		0xd2e, 0xc3f, 0xf0f, 0xe1e, 0x93c, 0x82d, 0xb1d, 0xa0c,
+		0x6cc, 0x7dd, 0x4ed, 0x5fc, 0x2de, 0x3cf, 0x0ff, 0x1ee,
+		0xeee, 0xfff, 0xccf, 0xdde, 0xafc, 0xbed, 0x8dd, 0x9cc,
+		0x788, 0x699, 0x5a9, 0x4b8, 0x39a, 0x28b, 0x1bb, 0x0aa,
+		0xfaa, 0xebb, 0xd8b, 0xc9a, 0xbb8, 0xaa9, 0x999, 0x888,
+		0x888, 0x999, 0xaa9, 0xbb8, 0xc9a, 0xd8b, 0xebb, 0xfaa,
+		0x0aa, 0x1bb, 0x28b, 0x39a, 0x4b8, 0x5a9, 0x699, 0x788,
+		0x9cc, 0x8dd, 0xbed, 0xafc, 0xdde, 0xccf, 0xfff, 0xeee,
+		0x1ee, 0x0ff, 0x3cf, 0x2de, 0x5fc, 0x4ed, 0x7dd, 0x6cc,
+		0xa0c, 0xb1d, 0x82d, 0x93c, 0xe1e, 0xf0f, 0xc3f, 0xd2e,
+		0x22e, 0x33f, 0x00f, 0x11e, 0x63c, 0x72d, 0x41d, 0x50c,
+		0xb48, 0xa59, 0x969, 0x878, 0xf5a, 0xe4b, 0xd7b, 0xc6a,
+		0x36a, 0x27b, 0x14b, 0x05a, 0x778, 0x669, 0x559, 0x448,
+		0xcc0, 0xdd1, 0xee1, 0xff0, 0x8d2, 0x9c3, 0xaf3, 0xbe2,
+		0x4e2, 0x5f3, 0x6c3, 0x7d2, 0x0f0, 0x1e1, 0x2d1, 0x3c0,
+		0xd84, 0xc95, 0xfa5, 0xeb4, 0x996, 0x887, 0xbb7, 0xaa6,
+		0x5a6, 0x4b7, 0x787, 0x696, 0x1b4, 0x0a5, 0x395, 0x284,
+		0xe44, 0xf55, 0xc65, 0xd74, 0xa56, 0xb47, 0x877, 0x966,
+		0x666, 0x777, 0x447, 0x556, 0x274, 0x365, 0x055, 0x144,
+		0xf00, 0xe11, 0xd21, 0xc30, 0xb12, 0xa03, 0x933, 0x822,
+		0x722, 0x633, 0x503, 0x412, 0x330, 0x221, 0x111, 0x000
+	};
+
+	template<typename Dummy>
+	const signed char MarchingCubesTablesT<Dummy>::triangles[256][16] = {
+		{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{4, 9, 5, 4, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 10, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 8, 0, 1, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 1, 10, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 9, 5, 1, 8, 9, 1, 10, 8, -1, -1, -1, -1, -1, -1, -1},
+		{1, 5, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 1, 5, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 1, 0, 9, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 9, 11, 1, 8, 9, 1, 4, 8, -1, -1, -1, -1, -1, -1, -1},
+		{4, 11, 10, 4, 5, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 8, 0, 11, 10, 0, 5, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 4, 0, 11, 10, 0, 9, 11, -1, -1, -1, -1, -1, -1, -1},
+		{8, 11, 10, 8, 9, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 2, 0, 4, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 2, 8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 4, 6, 2, 5, 4, 2, 9, 5, -1, -1, -1, -1, -1, -1, -1},
+		{1, 10, 4, 2, 8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 2, 0, 10, 6, 0, 1, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 1, 10, 4, 2, 8, 6, -1, -1, -1, -1, -1, -1, -1},
+		{1, 9, 5, 1, 2, 9, 1, 6, 2, 1, 10, 6, -1, -1, -1, -1},
+		{1, 5, 11, 2, 8, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 2, 0, 4, 6, 1, 5, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 1, 0, 9, 11, 2, 8, 6, -1, -1, -1, -1, -1, -1, -1},
+		{1, 9, 11, 1, 2, 9, 1, 6, 2, 1, 4, 6, -1, -1, -1, -1},
+		{2, 8, 6, 4, 11, 10, 4, 5, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 2, 0, 10, 6, 0, 11, 10, 0, 5, 11, -1, -1, -1, -1},
+		{0, 10, 4, 0, 11, 10, 0, 9, 11, 2, 8, 6, -1, -1, -1, -1},
+		{2, 10, 6, 2, 11, 10, 2, 9, 11, -1, -1, -1, -1, -1, -1, -1},
+		{2, 7, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 2, 7, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 5, 0, 2, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 4, 8, 2, 5, 4, 2, 7, 5, -1, -1, -1, -1, -1, -1, -1},
+		{1, 10, 4, 2, 7, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 8, 0, 1, 10, 2, 7, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 5, 0, 2, 7, 1, 10, 4, -1, -1, -1, -1, -1, -1, -1},
+		{1, 7, 5, 1, 2, 7, 1, 8, 2, 1, 10, 8, -1, -1, -1, -1},
+		{1, 5, 11, 2, 7, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 1, 5, 11, 2, 7, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 1, 0, 7, 11, 0, 2, 7, -1, -1, -1, -1, -1, -1, -1},
+		{1, 7, 11, 1, 2, 7, 1, 8, 2, 1, 4, 8, -1, -1, -1, -1},
+		{2, 7, 9, 4, 11, 10, 4, 5, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 8, 0, 11, 10, 0, 5, 11, 2, 7, 9, -1, -1, -1, -1},
+		{0, 10, 4, 0, 11, 10, 0, 7, 11, 0, 2, 7, -1, -1, -1, -1},
+		{2, 10, 8, 2, 11, 10, 2, 7, 11, -1, -1, -1, -1, -1, -1, -1},
+		{6, 9, 8, 6, 7, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 9, 0, 6, 7, 0, 4, 6, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 5, 0, 6, 7, 0, 8, 6, -1, -1, -1, -1, -1, -1, -1},
+		{4, 7, 5, 4, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 10, 4, 6, 9, 8, 6, 7, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 9, 0, 6, 7, 0, 10, 6, 0, 1, 10, -1, -1, -1, -1},
+		{0, 7, 5, 0, 6, 7, 0, 8, 6, 1, 10, 4, -1, -1, -1, -1},
+		{1, 7, 5, 1, 6, 7, 1, 10, 6, -1, -1, -1, -1, -1, -1, -1},
+		{1, 5, 11, 6, 9, 8, 6, 7, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 9, 0, 6, 7, 0, 4, 6, 1, 5, 11, -1, -1, -1, -1},
+		{0, 11, 1, 0, 7, 11, 0, 6, 7, 0, 8, 6, -1, -1, -1, -1},
+		{1, 7, 11, 1, 6, 7, 1, 4, 6, -1, -1, -1, -1, -1, -1, -1},
+		{4, 11, 10, 4, 5, 11, 6, 9, 8, 6, 7, 9, -1, -1, -1, -1},
+		{0, 7, 9, 0, 6, 7, 0, 10, 6, 0, 11, 10, 0, 5, 11, -1},
+		{0, 10, 4, 0, 11, 10, 0, 7, 11, 0, 6, 7, 0, 8, 6, -1},
+		{6, 11, 10, 6, 7, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{3, 6, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{3, 6, 10, 4, 9, 5, 4, 8, 9, -1, -1, -1, -1, -1, -1, -1},
+		{1, 6, 4, 1, 3, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 8, 0, 3, 6, 0, 1, 3, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 1, 6, 4, 1, 3, 6, -1, -1, -1, -1, -1, -1, -1},
+		{1, 9, 5, 1, 8, 9, 1, 6, 8, 1, 3, 6, -1, -1, -1, -1},
+		{1, 5, 11, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 1, 5, 11, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 1, 0, 9, 11, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1},
+		{1, 9, 11, 1, 8, 9, 1, 4, 8, 3, 6, 10, -1, -1, -1, -1},
+		{3, 5, 11, 3, 4, 5, 3, 6, 4, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 8, 0, 3, 6, 0, 11, 3, 0, 5, 11, -1, -1, -1, -1},
+		{0, 6, 4, 0, 3, 6, 0, 11, 3, 0, 9, 11, -1, -1, -1, -1},
+		{3, 9, 11, 3, 8, 9, 3, 6, 8, -1, -1, -1, -1, -1, -1, -1},
+		{2, 10, 3, 2, 8, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 3, 2, 0, 10, 3, 0, 4, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 2, 10, 3, 2, 8, 10, -1, -1, -1, -1, -1, -1, -1},
+		{2, 10, 3, 2, 4, 10, 2, 5, 4, 2, 9, 5, -1, -1, -1, -1},
+		{1, 8, 4, 1, 2, 8, 1, 3, 2, -1, -1, -1, -1, -1, -1, -1},
+		{0, 3, 2, 0, 1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 1, 8, 4, 1, 2, 8, 1, 3, 2, -1, -1, -1, -1},
+		{1, 9, 5, 1, 2, 9, 1, 3, 2, -1, -1, -1, -1, -1, -1, -1},
+		{1, 5, 11, 2, 10, 3, 2, 8, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 3, 2, 0, 10, 3, 0, 4, 10, 1, 5, 11, -1, -1, -1, -1},
+		{0, 11, 1, 0, 9, 11, 2, 10, 3, 2, 8, 10, -1, -1, -1, -1},
+		{9, 3, 2, 9, 10, 3, 9, 4, 10, 9, 1, 4, 9, 11, 1, -1},
+		{2, 11, 3, 2, 5, 11, 2, 4, 5, 2, 8, 4, -1, -1, -1, -1},
+		{0, 3, 2, 0, 11, 3, 0, 5, 11, -1, -1, -1, -1, -1, -1, -1},
+		{4, 2, 8, 4, 3, 2, 4, 11, 3, 4, 9, 11, 4, 0, 9, -1},
+		{2, 11, 3, 2, 9, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 7, 9, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 2, 7, 9, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 5, 0, 2, 7, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1},
+		{2, 4, 8, 2, 5, 4, 2, 7, 5, 3, 6, 10, -1, -1, -1, -1},
+		{1, 6, 4, 1, 3, 6, 2, 7, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 8, 0, 3, 6, 0, 1, 3, 2, 7, 9, -1, -1, -1, -1},
+		{0, 7, 5, 0, 2, 7, 1, 6, 4, 1, 3, 6, -1, -1, -1, -1},
+		{1, 7, 5, 1, 2, 7, 1, 8, 2, 1, 6, 8, 1, 3, 6, -1},
+		{1, 5, 11, 2, 7, 9, 3, 6, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 1, 5, 11, 2, 7, 9, 3, 6, 10, -1, -1, -1, -1},
+		{0, 11, 1, 0, 7, 11, 0, 2, 7, 3, 6, 10, -1, -1, -1, -1},
+		{1, 7, 11, 1, 2, 7, 1, 8, 2, 1, 4, 8, 3, 6, 10, -1},
+		{2, 7, 9, 3, 5, 11, 3, 4, 5, 3, 6, 4, -1, -1, -1, -1},
+		{0, 6, 8, 0, 3, 6, 0, 11, 3, 0, 5, 11, 2, 7, 9, -1},
+		{0, 6, 4, 0, 3, 6, 0, 11, 3, 0, 7, 11, 0, 2, 7, -1},
+		{8, 3, 6, 8, 11, 3, 8, 7, 11, 8, 2, 7, -1, -1, -1, -1},
+		{3, 8, 10, 3, 9, 8, 3, 7, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 9, 0, 3, 7, 0, 10, 3, 0, 4, 10, -1, -1, -1, -1},
+		{0, 7, 5, 0, 3, 7, 0, 10, 3, 0, 8, 10, -1, -1, -1, -1},
+		{3, 4, 10, 3, 5, 4, 3, 7, 5, -1, -1, -1, -1, -1, -1, -1},
+		{1, 8, 4, 1, 9, 8, 1, 7, 9, 1, 3, 7, -1, -1, -1, -1},
+		{0, 7, 9, 0, 3, 7, 0, 1, 3, -1, -1, -1, -1, -1, -1, -1},
+		{7, 1, 3, 7, 4, 1, 7, 8, 4, 7, 0, 8, 7, 5, 0, -1},
+		{1, 7, 5, 1, 3, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 5, 11, 3, 8, 10, 3, 9, 8, 3, 7, 9, -1, -1, -1, -1},
+		{0, 7, 9, 0, 3, 7, 0, 10, 3, 0, 4, 10, 1, 5, 11, -1},
+		{0, 11, 1, 0, 7, 11, 0, 3, 7, 0, 10, 3, 0, 8, 10, -1},
+		{7, 10, 3, 7, 4, 10, 7, 1, 4, 7, 11, 1, -1, -1, -1, -1},
+		{3, 5, 11, 3, 4, 5, 3, 8, 4, 3, 9, 8, 3, 7, 9, -1},
+		{0, 7, 9, 0, 3, 7, 0, 11, 3, 0, 5, 11, -1, -1, -1, -1},
+		{0, 8, 4, 3, 7, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{3, 7, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{3, 11, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{3, 11, 7, 4, 9, 5, 4, 8, 9, -1, -1, -1, -1, -1, -1, -1},
+		{1, 10, 4, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 8, 0, 1, 10, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 1, 10, 4, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+		{1, 9, 5, 1, 8, 9, 1, 10, 8, 3, 11, 7, -1, -1, -1, -1},
+		{1, 7, 3, 1, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 1, 7, 3, 1, 5, 7, -1, -1, -1, -1, -1, -1, -1},
+		{0, 3, 1, 0, 7, 3, 0, 9, 7, -1, -1, -1, -1, -1, -1, -1},
+		{1, 7, 3, 1, 9, 7, 1, 8, 9, 1, 4, 8, -1, -1, -1, -1},
+		{3, 5, 7, 3, 4, 5, 3, 10, 4, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 8, 0, 3, 10, 0, 7, 3, 0, 5, 7, -1, -1, -1, -1},
+		{0, 10, 4, 0, 3, 10, 0, 7, 3, 0, 9, 7, -1, -1, -1, -1},
+		{3, 9, 7, 3, 8, 9, 3, 10, 8, -1, -1, -1, -1, -1, -1, -1},
+		{2, 8, 6, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 2, 0, 4, 6, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 2, 8, 6, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+		{2, 4, 6, 2, 5, 4, 2, 9, 5, 3, 11, 7, -1, -1, -1, -1},
+		{1, 10, 4, 2, 8, 6, 3, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 2, 0, 10, 6, 0, 1, 10, 3, 11, 7, -1, -1, -1, -1},
+		{0, 9, 5, 1, 10, 4, 2, 8, 6, 3, 11, 7, -1, -1, -1, -1},
+		{1, 9, 5, 1, 2, 9, 1, 6, 2, 1, 10, 6, 3, 11, 7, -1},
+		{1, 7, 3, 1, 5, 7, 2, 8, 6, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 2, 0, 4, 6, 1, 7, 3, 1, 5, 7, -1, -1, -1, -1},
+		{0, 3, 1, 0, 7, 3, 0, 9, 7, 2, 8, 6, -1, -1, -1, -1},
+		{1, 7, 3, 1, 9, 7, 1, 2, 9, 1, 6, 2, 1, 4, 6, -1},
+		{2, 8, 6, 3, 5, 7, 3, 4, 5, 3, 10, 4, -1, -1, -1, -1},
+		{0, 6, 2, 0, 10, 6, 0, 3, 10, 0, 7, 3, 0, 5, 7, -1},
+		{0, 10, 4, 0, 3, 10, 0, 7, 3, 0, 9, 7, 2, 8, 6, -1},
+		{10, 7, 3, 10, 9, 7, 10, 2, 9, 10, 6, 2, -1, -1, -1, -1},
+		{2, 11, 9, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 2, 11, 9, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 5, 0, 3, 11, 0, 2, 3, -1, -1, -1, -1, -1, -1, -1},
+		{2, 4, 8, 2, 5, 4, 2, 11, 5, 2, 3, 11, -1, -1, -1, -1},
+		{1, 10, 4, 2, 11, 9, 2, 3, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 8, 0, 1, 10, 2, 11, 9, 2, 3, 11, -1, -1, -1, -1},
+		{0, 11, 5, 0, 3, 11, 0, 2, 3, 1, 10, 4, -1, -1, -1, -1},
+		{5, 3, 11, 5, 2, 3, 5, 8, 2, 5, 10, 8, 5, 1, 10, -1},
+		{1, 2, 3, 1, 9, 2, 1, 5, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 1, 2, 3, 1, 9, 2, 1, 5, 9, -1, -1, -1, -1},
+		{0, 3, 1, 0, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 2, 3, 1, 8, 2, 1, 4, 8, -1, -1, -1, -1, -1, -1, -1},
+		{2, 5, 9, 2, 4, 5, 2, 10, 4, 2, 3, 10, -1, -1, -1, -1},
+		{10, 2, 3, 10, 9, 2, 10, 5, 9, 10, 0, 5, 10, 8, 0, -1},
+		{0, 10, 4, 0, 3, 10, 0, 2, 3, -1, -1, -1, -1, -1, -1, -1},
+		{2, 10, 8, 2, 3, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{3, 8, 6, 3, 9, 8, 3, 11, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 9, 0, 3, 11, 0, 6, 3, 0, 4, 6, -1, -1, -1, -1},
+		{0, 11, 5, 0, 3, 11, 0, 6, 3, 0, 8, 6, -1, -1, -1, -1},
+		{3, 4, 6, 3, 5, 4, 3, 11, 5, -1, -1, -1, -1, -1, -1, -1},
+		{1, 10, 4, 3, 8, 6, 3, 9, 8, 3, 11, 9, -1, -1, -1, -1},
+		{0, 11, 9, 0, 3, 11, 0, 6, 3, 0, 10, 6, 0, 1, 10, -1},
+		{0, 11, 5, 0, 3, 11, 0, 6, 3, 0, 8, 6, 1, 10, 4, -1},
+		{5, 3, 11, 5, 6, 3, 5, 10, 6, 5, 1, 10, -1, -1, -1, -1},
+		{1, 6, 3, 1, 8, 6, 1, 9, 8, 1, 5, 9, -1, -1, -1, -1},
+		{9, 1, 5, 9, 3, 1, 9, 6, 3, 9, 4, 6, 9, 0, 4, -1},
+		{0, 3, 1, 0, 6, 3, 0, 8, 6, -1, -1, -1, -1, -1, -1, -1},
+		{1, 6, 3, 1, 4, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{3, 8, 6, 3, 9, 8, 3, 5, 9, 3, 4, 5, 3, 10, 4, -1},
+		{0, 5, 9, 3, 10, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 10, 4, 0, 3, 10, 0, 6, 3, 0, 8, 6, -1, -1, -1, -1},
+		{3, 10, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{6, 11, 7, 6, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 6, 11, 7, 6, 10, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 6, 11, 7, 6, 10, 11, -1, -1, -1, -1, -1, -1, -1},
+		{4, 9, 5, 4, 8, 9, 6, 11, 7, 6, 10, 11, -1, -1, -1, -1},
+		{1, 6, 4, 1, 7, 6, 1, 11, 7, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 8, 0, 7, 6, 0, 11, 7, 0, 1, 11, -1, -1, -1, -1},
+		{0, 9, 5, 1, 6, 4, 1, 7, 6, 1, 11, 7, -1, -1, -1, -1},
+		{1, 9, 5, 1, 8, 9, 1, 6, 8, 1, 7, 6, 1, 11, 7, -1},
+		{1, 6, 10, 1, 7, 6, 1, 5, 7, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 1, 6, 10, 1, 7, 6, 1, 5, 7, -1, -1, -1, -1},
+		{0, 10, 1, 0, 6, 10, 0, 7, 6, 0, 9, 7, -1, -1, -1, -1},
+		{1, 6, 10, 1, 7, 6, 1, 9, 7, 1, 8, 9, 1, 4, 8, -1},
+		{4, 7, 6, 4, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 8, 0, 7, 6, 0, 5, 7, -1, -1, -1, -1, -1, -1, -1},
+		{0, 6, 4, 0, 7, 6, 0, 9, 7, -1, -1, -1, -1, -1, -1, -1},
+		{6, 9, 7, 6, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 11, 7, 2, 10, 11, 2, 8, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 2, 0, 11, 7, 0, 10, 11, 0, 4, 10, -1, -1, -1, -1},
+		{0, 9, 5, 2, 11, 7, 2, 10, 11, 2, 8, 10, -1, -1, -1, -1},
+		{2, 11, 7, 2, 10, 11, 2, 4, 10, 2, 5, 4, 2, 9, 5, -1},
+		{1, 8, 4, 1, 2, 8, 1, 7, 2, 1, 11, 7, -1, -1, -1, -1},
+		{0, 7, 2, 0, 11, 7, 0, 1, 11, -1, -1, -1, -1, -1, -1, -1},
+		{0, 9, 5, 1, 8, 4, 1, 2, 8, 1, 7, 2, 1, 11, 7, -1},
+		{1, 9, 5, 1, 2, 9, 1, 7, 2, 1, 11, 7, -1, -1, -1, -1},
+		{1, 8, 10, 1, 2, 8, 1, 7, 2, 1, 5, 7, -1, -1, -1, -1},
+		{2, 5, 7, 2, 1, 5, 2, 10, 1, 2, 4, 10, 2, 0, 4, -1},
+		{1, 8, 10, 1, 2, 8, 1, 7, 2, 1, 9, 7, 1, 0, 9, -1},
+		{1, 4, 10, 2, 9, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 5, 7, 2, 4, 5, 2, 8, 4, -1, -1, -1, -1, -1, -1, -1},
+		{0, 7, 2, 0, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{4, 2, 8, 4, 7, 2, 4, 9, 7, 4, 0, 9, -1, -1, -1, -1},
+		{2, 9, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 11, 9, 2, 10, 11, 2, 6, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 4, 8, 2, 11, 9, 2, 10, 11, 2, 6, 10, -1, -1, -1, -1},
+		{0, 11, 5, 0, 10, 11, 0, 6, 10, 0, 2, 6, -1, -1, -1, -1},
+		{2, 4, 8, 2, 5, 4, 2, 11, 5, 2, 10, 11, 2, 6, 10, -1},
+		{1, 6, 4, 1, 2, 6, 1, 9, 2, 1, 11, 9, -1, -1, -1, -1},
+		{6, 9, 2, 6, 11, 9, 6, 1, 11, 6, 0, 1, 6, 8, 0, -1},
+		{11, 4, 1, 11, 6, 4, 11, 2, 6, 11, 0, 2, 11, 5, 0, -1},
+		{1, 11, 5, 2, 6, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 6, 10, 1, 2, 6, 1, 9, 2, 1, 5, 9, -1, -1, -1, -1},
+		{0, 4, 8, 1, 6, 10, 1, 2, 6, 1, 9, 2, 1, 5, 9, -1},
+		{0, 10, 1, 0, 6, 10, 0, 2, 6, -1, -1, -1, -1, -1, -1, -1},
+		{1, 6, 10, 1, 2, 6, 1, 8, 2, 1, 4, 8, -1, -1, -1, -1},
+		{2, 5, 9, 2, 4, 5, 2, 6, 4, -1, -1, -1, -1, -1, -1, -1},
+		{6, 9, 2, 6, 5, 9, 6, 0, 5, 6, 8, 0, -1, -1, -1, -1},
+		{0, 6, 4, 0, 2, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{2, 6, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{8, 11, 9, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 9, 0, 10, 11, 0, 4, 10, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 5, 0, 10, 11, 0, 8, 10, -1, -1, -1, -1, -1, -1, -1},
+		{4, 11, 5, 4, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 8, 4, 1, 9, 8, 1, 11, 9, -1, -1, -1, -1, -1, -1, -1},
+		{0, 11, 9, 0, 1, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{11, 4, 1, 11, 8, 4, 11, 0, 8, 11, 5, 0, -1, -1, -1, -1},
+		{1, 11, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 8, 10, 1, 9, 8, 1, 5, 9, -1, -1, -1, -1, -1, -1, -1},
+		{9, 1, 5, 9, 10, 1, 9, 4, 10, 9, 0, 4, -1, -1, -1, -1},
+		{0, 10, 1, 0, 8, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{1, 4, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{4, 9, 8, 4, 5, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 5, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{0, 8, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+		{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}
+	};
+
+	/// The marching cubes case tables
+	typedef MarchingCubesTablesT<> MarchingCubesTables;
+
+	namespace detail {
+		/// @internal
+		/// @brief Cache entry for an edge with no vertex (yet).
+		const stdint::uint32_t MARCHING_CUBES_NO_VERTEX = 0xffffffffu;
+
+		/// @internal
+		/// @brief Sets out[i] to 1 if values[i] < iso, 0 otherwise: the
+		/// reference for the SIMD overloads.
+		template<typename Scalar>
+		inline void marchingCubesClassifyScalar(Scalar const* values, std::size_t n, Scalar iso, unsigned char * out) {
+			for (std::size_t i = 0; i < n; ++i) {
+				out[i] = values[i] < iso;
+			}
+		}
+
+		/// @internal
+		template<typename Scalar>
+		inline void marchingCubesClassify(Scalar const* values, std::size_t n, Scalar iso, unsigned char * out) {
+			marchingCubesClassifyScalar(values, n, iso, out);
+		}
+
+#ifdef UTIL_MARCHINGCUBES_SSE2
+		/// @internal
+		/// @brief 16 floats per iteration: four compares packed down to bytes.
+		inline void marchingCubesClassify(float const* values, std::size_t n, float iso, unsigned char * out) {
+			const __m128 threshold = _mm_set1_ps(iso);
+			const __m128i one = _mm_set1_epi8(1);
+			std::size_t i = 0;
+			for (; i + 16 <= n; i += 16) {
+				const __m128i a = _mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(values + i), threshold));
+				const __m128i b = _mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(values + i + 4), threshold));
+				const __m128i c = _mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(values + i + 8), threshold));
+				const __m128i d = _mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(values + i + 12), threshold));
+				const __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_and_si128(bytes, one));
+			}
+			marchingCubesClassifyScalar(values + i, n - i, iso, out + i);
+		}
+
+		/// @internal
+		/// @brief 2 doubles per compare, spread from the sign mask.
+		inline void marchingCubesClassify(double const* values, std::size_t n, double iso, unsigned char * out) {
+			const __m128d threshold = _mm_set1_pd(iso);
+			std::size_t i = 0;
+			for (; i + 2 <= n; i += 2) {
+				const int bits = _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(values + i), threshold));
+				out[i] = bits & 1;
+				out[i + 1] = bits >> 1;
+			}
+			marchingCubesClassifyScalar(values + i, n - i, iso, out + i);
+		}
+#endif
+
+		/// @internal
+		/// @brief Computes the cases of a row of n cells from the
+		/// classified rows of their 4 corner lines (n + 1 entries each), in
+		/// Cube::Vertex bit order: x is bit 0, the row at y + 1 bit 1, the
+		/// plane at z + 1 bit 2.
+		/// @returns false if every cell in the row is entirely above or
+		/// entirely below the isovalue.
+		inline bool marchingCubesCombineCases(unsigned char const* y0z0, unsigned char const* y1z0,
+		                                      unsigned char const* y0z1, unsigned char const* y1z1,
+		                                      std::size_t n, unsigned char * cases) {
+			std::size_t i = 0;
+			bool active = false;
+#ifdef UTIL_MARCHINGCUBES_SSE2
+#define UTIL_MARCHINGCUBES_CORNERS(ROW, SHIFT) \
+	_mm_or_si128(_mm_slli_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ROW + i)), SHIFT), \
+	             _mm_slli_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ROW + i + 1)), SHIFT + 1))
+			/// Entries are 0 or 1, so shifting 16-bit lanes by at most 7
+			/// never carries into the neighboring byte.
+			const __m128i all = _mm_set1_epi8(-1);
+			__m128i uniform = all;
+			for (; i + 16 <= n; i += 16) {
+				const __m128i c = _mm_or_si128(
+				                      _mm_or_si128(UTIL_MARCHINGCUBES_CORNERS(y0z0, 0), UTIL_MARCHINGCUBES_CORNERS(y1z0, 2)),
+				                      _mm_or_si128(UTIL_MARCHINGCUBES_CORNERS(y0z1, 4), UTIL_MARCHINGCUBES_CORNERS(y1z1, 6)));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(cases + i), c);
+				uniform = _mm_and_si128(uniform, _mm_or_si128(_mm_cmpeq_epi8(c, _mm_setzero_si128()), _mm_cmpeq_epi8(c, all)));
+			}
+			active = _mm_movemask_epi8(uniform) != 0xffff;
+#undef UTIL_MARCHINGCUBES_CORNERS
+#endif
+			for (; i < n; ++i) {
+				const unsigned char c = y0z0[i] | (y0z0[i + 1] << 1) | (y1z0[i] << 2) | (y1z0[i + 1] << 3)
+				                        | (y0z1[i] << 4) | (y0z1[i + 1] << 5) | (y1z1[i] << 6) | (y1z1[i + 1] << 7);
+				cases[i] = c;
+				active = active || (c != 0 && c != 0xff);
+			}
+			return active;
+		}
+
+		/// @internal
+		/// @brief Thread entry point extracting one slab.
+		template<typename ExtractorType>
+		class MarchingCubesSlabTask {
+			public:
+				MarchingCubesSlabTask(ExtractorType const& extractor, typename ExtractorType::Scalar iso,
+				                      int zBegin, int zEnd, typename ExtractorType::Slab & slab)
+					: _extractor(&extractor)
+					, _iso(iso)
+					, _zBegin(zBegin)
+					, _zEnd(zEnd)
+					, _slab(&slab)
+				{}
+
+				void operator()() const {
+					_extractor->extractSlab(_iso, _zBegin, _zEnd, *_slab);
+				}
+
+			private:
+				ExtractorType const* _extractor;
+				typename ExtractorType::Scalar _iso;
+				int _zBegin;
+				int _zEnd;
+				typename ExtractorType::Slab * _slab;
+		};
+	} // end of namespace detail
+
+	/// @brief An indexed triangle mesh produced by isosurface extraction.
+	template<typename _Scalar>
+	struct IsosurfaceMesh {
+		typedef _Scalar Scalar;
+		typedef Eigen::Matrix<Scalar, 3, 1> VectorType;
+
+		std::vector<VectorType> vertices;
+		/// Vertex indices, three per triangle
+		std::vector<stdint::uint32_t> indices;
+
+		std::size_t triangleCount() const {
+			return indices.size() / 3;
+		}
+
+		void clear() {
+			vertices.clear();
+			indices.clear();
+		}
+	};
+
+	/** @brief Marching cubes extraction of isosurfaces from a dense scalar
+		grid.
+
+		The grid is not copied: it must outlive the extractor. Samples are
+		stored with x varying fastest, then y, then z, and sample (i, j, k)
+		sits at origin + spacing .* (i, j, k).
+
+		The result is the same (vertex for vertex, index for index) whatever
+		the number of threads used.
+	*/
+	template<typename _Scalar>
+	class MarchingCubes {
+		public:
+			typedef _Scalar Scalar;
+			typedef Eigen::Matrix<Scalar, 3, 1> VectorType;
+			typedef IsosurfaceMesh<Scalar> MeshType;
+			typedef MarchingCubesTables Tables;
+
+			/** @brief The output of a slab: a run of cell layers, [zBegin, zEnd).
+
+				Besides its own mesh, a slab keeps the vertex indices of the x
+				and y edges on its first and last grid planes, so slabs can be
+				merged without duplicating the vertices they share.
+			*/
+			struct Slab {
+				std::vector<VectorType> vertices;
+				std::vector<stdint::uint32_t> indices;
+				std::vector<stdint::uint32_t> firstX;
+				std::vector<stdint::uint32_t> firstY;
+				std::vector<stdint::uint32_t> lastX;
+				std::vector<stdint::uint32_t> lastY;
+			};
+
+			/// @brief Constructor from the grid samples and the number of
+			/// samples along each axis (at least 2).
+			MarchingCubes(Scalar const* values, Eigen::Vector3i const& dims,
+			              VectorType const& origin = VectorType::Zero(),
+			              VectorType const& spacing = VectorType::Ones())
+				: _values(values)
+				, _dims(dims)
+				, _origin(origin)
+				, _spacing(spacing) {
+				if (!values) {
+					throw std::invalid_argument("Marching cubes needs grid values!");
+				}
+				if ((dims.array() < 2).any()) {
+					throw std::invalid_argument("Marching cubes needs at least 2 samples along each axis!");
+				}
+			}
+
+			Eigen::Vector3i const& dims() const {
+				return _dims;
+			}
+
+			/// @brief Number of cell layers along z, the unit slabs are made of.
+			int layers() const {
+				return _dims[2] - 1;
+			}
+
+			/// @brief Extract the isosurface at @p iso into @p mesh, using up
+			/// to @p threads threads (one slab of cell layers each).
+			void extract(Scalar iso, MeshType & mesh, unsigned int threads = 1) const {
+				const int slabCount = static_cast<int>(std::max(1u, std::min(threads, static_cast<unsigned int>(layers()))));
+				std::vector<Slab> slabs(slabCount);
+				if (slabCount == 1) {
+					extractSlab(iso, 0, layers(), slabs[0]);
+				} else {
+					boost::thread_group group;
+					for (int i = 0; i < slabCount; ++i) {
+						group.create_thread(detail::MarchingCubesSlabTask<MarchingCubes>(*this, iso,
+						                    layers() * i / slabCount, layers() * (i + 1) / slabCount, slabs[i]));
+					}
+					group.join_all();
+				}
+				mergeSlabs(slabs, mesh);
+			}
+
+			/// @brief Extract the isosurface within cell layers [zBegin, zEnd).
+			///
+			/// Independent slabs may be extracted concurrently.
+			void extractSlab(Scalar iso, int zBegin, int zEnd, Slab & slab) const {
+				if (zBegin < 0 || zEnd > layers() || zBegin >= zEnd) {
+					throw std::out_of_range("Slab layers specified are out of range!");
+				}
+				const int nx = _dims[0];
+				const int ny = _dims[1];
+				const std::size_t plane = std::size_t(nx) * ny;
+				const std::size_t xEdges = std::size_t(nx - 1) * ny;
+				const std::size_t yEdges = std::size_t(nx) * (ny - 1);
+				const stdint::uint32_t none = detail::MARCHING_CUBES_NO_VERTEX;
+
+				slab.vertices.clear();
+				slab.indices.clear();
+
+				/// Two planes of each: the bottom and top of the current layer
+				std::vector<unsigned char> below(2 * plane);
+				std::vector<stdint::uint32_t> xCache(2 * xEdges, none);
+				std::vector<stdint::uint32_t> yCache(2 * yEdges, none);
+				std::vector<stdint::uint32_t> zCache(plane);
+				std::vector<unsigned char> cases(nx - 1);
+
+				detail::marchingCubesClassify(_values + zBegin * plane, plane, iso, &below[0]);
+				for (int z = zBegin; z < zEnd; ++z) {
+					const std::size_t b = (z - zBegin) & 1;
+					const std::size_t t = b ^ 1;
+					detail::marchingCubesClassify(_values + (z + 1) * plane, plane, iso, &below[t * plane]);
+					std::fill(xCache.begin() + t * xEdges, xCache.begin() + (t + 1) * xEdges, none);
+					std::fill(yCache.begin() + t * yEdges, yCache.begin() + (t + 1) * yEdges, none);
+					std::fill(zCache.begin(), zCache.end(), none);
+
+					for (int y = 0; y + 1 < ny; ++y) {
+						unsigned char const* bottom = &below[b * plane + std::size_t(y) * nx];
+						unsigned char const* top = &below[t * plane + std::size_t(y) * nx];
+						if (!detail::marchingCubesCombineCases(bottom, bottom + nx, top, top + nx, nx - 1, &cases[0])) {
+							continue;
+						}
+						for (int x = 0; x + 1 < nx; ++x) {
+							const unsigned char c = cases[x];
+							const unsigned int mask = Tables::edgeMask[c];
+							if (!mask) {
+								continue;
+							}
+							stdint::uint32_t ids[12];
+							for (int e = 0; e < 12; ++e) {
+								if (!(mask & (1u << e))) {
+									continue;
+								}
+								/// Start from the end of edge e with its axis bit clear
+								const int axis = e >> 2;
+								const int start = CubeTables::edgeVertices[e][0];
+								const int px = x + (start & 1);
+								const int py = y + ((start >> 1) & 1);
+								const int pz = z + (start >> 2);
+								stdint::uint32_t * slot;
+								if (axis == 0) {
+									slot = &xCache[(pz == z ? b : t) * xEdges + std::size_t(py) * (nx - 1) + px];
+								} else if (axis == 1) {
+									slot = &yCache[(pz == z ? b : t) * yEdges + std::size_t(py) * nx + px];
+								} else {
+									slot = &zCache[std::size_t(py) * nx + px];
+								}
+								if (*slot == none) {
+									*slot = static_cast<stdint::uint32_t>(slab.vertices.size());
+									slab.vertices.push_back(_edgeVertex(iso, px, py, pz, axis));
+								}
+								ids[e] = *slot;
+							}
+							for (signed char const* edge = Tables::triangles[c]; *edge >= 0; ++edge) {
+								slab.indices.push_back(ids[*edge]);
+							}
+						}
+					}
+
+					if (z == zBegin) {
+						slab.firstX.assign(xCache.begin() + b * xEdges, xCache.begin() + (b + 1) * xEdges);
+						slab.firstY.assign(yCache.begin() + b * yEdges, yCache.begin() + (b + 1) * yEdges);
+					}
+					if (z + 1 == zEnd) {
+						slab.lastX.assign(xCache.begin() + t * xEdges, xCache.begin() + (t + 1) * xEdges);
+						slab.lastY.assign(yCache.begin() + t * yEdges, yCache.begin() + (t + 1) * yEdges);
+					}
+				}
+			}
+
+			/// @brief Join consecutive slabs, in order of increasing z and
+			/// covering adjacent layers, into one mesh.
+			static void mergeSlabs(std::vector<Slab> const& slabs, MeshType & mesh) {
+				const stdint::uint32_t none = detail::MARCHING_CUBES_NO_VERTEX;
+				mesh.clear();
+				std::size_t vertexCount = 0;
+				std::size_t indexCount = 0;
+				for (std::size_t s = 0; s < slabs.size(); ++s) {
+					vertexCount += slabs[s].vertices.size();
+					indexCount += slabs[s].indices.size();
+				}
+				mesh.vertices.reserve(vertexCount);
+				mesh.indices.reserve(indexCount);
+
+				/// Slab-local to mesh vertex indices, for this slab and the previous one
+				std::vector<stdint::uint32_t> remap;
+				std::vector<stdint::uint32_t> previousRemap;
+				for (std::size_t s = 0; s < slabs.size(); ++s) {
+					Slab const& slab = slabs[s];
+					remap.assign(slab.vertices.size(), none);
+					if (s > 0) {
+						_shareBoundary(slabs[s - 1].lastX, slab.firstX, previousRemap, remap);
+						_shareBoundary(slabs[s - 1].lastY, slab.firstY, previousRemap, remap);
+					}
+					for (std::size_t v = 0; v < slab.vertices.size(); ++v) {
+						if (remap[v] == none) {
+							remap[v] = static_cast<stdint::uint32_t>(mesh.vertices.size());
+							mesh.vertices.push_back(slab.vertices[v]);
+						}
+					}
+					for (std::size_t i = 0; i < slab.indices.size(); ++i) {
+						mesh.indices.push_back(remap[slab.indices[i]]);
+					}
+					previousRemap.swap(remap);
+				}
+			}
+
+		private:
+			/// @brief The surface vertex on the edge from sample (x, y, z) along axis
+			VectorType _edgeVertex(Scalar iso, int x, int y, int z, int axis) const {
+				const std::size_t stride[3] = {1, std::size_t(_dims[0]), std::size_t(_dims[0]) * _dims[1]};
+				const std::size_t i = x + stride[1] * y + stride[2] * z;
+				const Scalar v0 = _values[i];
+				const Scalar v1 = _values[i + stride[axis]];
+				VectorType p(x, y, z);
+				p[axis] += (iso - v0) / (v1 - v0);
+				return _origin + _spacing.cwiseProduct(p);
+			}
+
+			/// @brief Map the vertices a slab created on its first plane to
+			/// those the previous slab created on the same edges.
+			static void _shareBoundary(std::vector<stdint::uint32_t> const& previousLast,
+			                           std::vector<stdint::uint32_t> const& first,
+			                           std::vector<stdint::uint32_t> const& previousRemap,
+			                           std::vector<stdint::uint32_t> & remap) {
+				const stdint::uint32_t none = detail::MARCHING_CUBES_NO_VERTEX;
+				for (std::size_t i = 0; i < first.size(); ++i) {
+					if (first[i] != none && previousLast[i] != none) {
+						remap[first[i]] = previousRemap[previousLast[i]];
+					}
+				}
+			}
+
+			Scalar const* _values;
+			Eigen::Vector3i _dims;
+			VectorType _origin;
+			VectorType _spacing;
+	};
+
+	/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_MarchingCubes_h_GUID_47e71d35_27de_4490_bc40_e7da563936d0
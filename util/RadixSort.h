@@ -0,0 +1,137 @@
+/** @file
+	@brief LSD radix sort for vectors of unsigned integer keys.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_RadixSort_h_GUID_bbf0bdaa_6931_48a4_9f0c_22aca1f793bd
+#define INCLUDED_RadixSort_h_GUID_bbf0bdaa_6931_48a4_9f0c_22aca1f793bd
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_unsigned.hpp>
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+namespace util {
+
+/// @addtogroup DataStructures Data Structures
+/// @{
+
+	namespace detail {
+		/// @internal
+		/// @brief The sorting passes of radixSort, ping-ponging between
+		/// keys and scratch.
+		/// @returns whichever of the two holds the sorted keys.
+		template<typename Key>
+		Key * radixSortPasses(Key * keys, Key * scratch, std::size_t n) {
+			BOOST_STATIC_ASSERT_MSG(boost::is_unsigned<Key>::value, "radixSort requires an unsigned integer key type");
+			static const std::size_t DIGITS = sizeof(Key);
+			if (n < 2) {
+				return keys;
+			}
+
+			std::vector<std::size_t> counts(DIGITS * 256, 0);
+			for (std::size_t i = 0; i < n; ++i) {
+				Key k = keys[i];
+				for (std::size_t d = 0; d < DIGITS; ++d) {
+					++counts[d * 256 + (k & 0xff)];
+					k >>= 8;
+				}
+			}
+
+			Key * src = keys;
+			Key * dest = scratch;
+			for (std::size_t d = 0; d < DIGITS; ++d) {
+				std::size_t * count = &counts[d * 256];
+				const std::size_t shift = d * 8;
+				if (count[(src[0] >> shift) & 0xff] == n) {
+					/// Every key has the same value for this digit.
+					continue;
+				}
+				std::size_t offset = 0;
+				for (std::size_t b = 0; b < 256; ++b) {
+					const std::size_t c = count[b];
+					count[b] = offset;
+					offset += c;
+				}
+				for (std::size_t i = 0; i < n; ++i) {
+					const Key k = src[i];
+					dest[count[(k >> shift) & 0xff]++] = k;
+				}
+				std::swap(src, dest);
+			}
+			return src;
+		}
+	} // end of namespace detail
+
+	/** @brief Sort a vector of unsigned integer keys in ascending order with
+		a least-significant-digit radix sort using 8-bit digits.
+
+		The histograms for every digit are gathered in a single pass over the
+		input, and any digit that is the same for every key (for instance,
+		the high bytes of small indices) is skipped entirely.
+
+		@param keys The keys to sort, in place.
+		@param scratch Working storage, resized to match keys: pass the same
+		vector to repeated calls to avoid reallocating it.
+	*/
+	template<typename Key>
+	void radixSort(std::vector<Key> & keys, std::vector<Key> & scratch) {
+		const std::size_t n = keys.size();
+		if (n < 2) {
+			return;
+		}
+		scratch.resize(n);
+		if (detail::radixSortPasses(&keys[0], &scratch[0], n) != &keys[0]) {
+			keys.swap(scratch);
+		}
+	}
+
+	/** @brief Sort the n unsigned integer keys starting at keys, using
+		scratch (room for n keys) as working storage.
+
+		For sorting parts of a larger array, such as the buckets of a
+		parallel sort, without a vector for each.
+	*/
+	template<typename Key>
+	void radixSort(Key * keys, std::size_t n, Key * scratch) {
+		Key * sorted = detail::radixSortPasses(keys, scratch, n);
+		if (sorted != keys) {
+			std::copy(sorted, sorted + n, keys);
+		}
+	}
+
+	/// @overload
+	template<typename Key>
+	void radixSort(std::vector<Key> & keys) {
+		std::vector<Key> scratch;
+		radixSort(keys, scratch);
+	}
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_RadixSort_h_GUID_bbf0bdaa_6931_48a4_9f0c_22aca1f793bd
@@ -23,14 +23,15 @@
 #define INCLUDED_RangedInt_h_GUID_2295a8dd_08fa_4f09_9708_9dc525156a3d
 
 // Internal Includes
-// - none
+#include <util/booststdint.h>
 
 // Library/third-party includes
-// - none
+#include <boost/integer.hpp>
 
 // Standard includes
 #include <stdexcept>
 #include <cassert>
+#include <climits>
 
 
 namespace util {
@@ -111,6 +112,94 @@ namespace util {
 				CheckMax<actuallyCheck, MaxVal, ErrorPolicy>::check(val);
 			}
 		};
+
+		/// @brief Tag for constructing a RangedInt from a value already
+		/// known to be in range, used by the arithmetic operators.
+		struct KnownInRange {};
+
+		template<stdint::intmax_t A, stdint::intmax_t B>
+		struct StaticMin {
+			static const stdint::intmax_t value = A < B ? A : B;
+		};
+
+		template<stdint::intmax_t A, stdint::intmax_t B>
+		struct StaticMax {
+			static const stdint::intmax_t value = A < B ? B : A;
+		};
+
+		template<bool rhsChecked, typename LhsType, typename RhsType>
+		struct ResultCheckingPolicy {
+			typedef typename LhsType::checking_policy type;
+		};
+
+		template<typename LhsType, typename RhsType>
+		struct ResultCheckingPolicy<false, LhsType, RhsType> {
+			typedef typename RhsType::checking_policy type;
+		};
+
+		template<bool condition, typename TrueType, typename FalseType>
+		struct SelectType {
+			typedef TrueType type;
+		};
+
+		template<typename TrueType, typename FalseType>
+		struct SelectType<false, TrueType, FalseType> {
+			typedef FalseType type;
+		};
+
+		/// @brief The narrowest integer type holding every value in
+		/// [MinVal, MaxVal]: unsigned if MinVal is non-negative.
+		template<int MinVal, int MaxVal, bool isUnsigned = (MinVal >= 0)>
+		struct RangedIntStorage {
+			typedef typename boost::uint_value_t<MaxVal>::least type;
+		};
+
+		template<int MinVal, int MaxVal>
+		struct RangedIntStorage<MinVal, MaxVal, false> {
+			typedef typename boost::int_min_value_t<MinVal>::least min_type;
+			typedef typename boost::int_max_value_t<MaxVal>::least max_type;
+			typedef typename SelectType < (sizeof(max_type) > sizeof(min_type)), max_type, min_type >::type type;
+		};
+
+		/// @brief The type of an arithmetic result with the given range:
+		/// it is only checked if both operands were, so an unchecked
+		/// operand still gets checked when assigned into a checked type.
+		///
+		/// The bounds are computed in intmax_t; if they do not fit in int,
+		/// there is no type, which removes the ranged operator.
+		template < stdint::intmax_t ResultMin, stdint::intmax_t ResultMax, typename LhsType, typename RhsType,
+		         bool fits = (ResultMin >= INT_MIN && ResultMax <= INT_MAX) >
+		struct RangedResult {
+			typedef RangedInt<int(ResultMin), int(ResultMax), typename ResultCheckingPolicy<RhsType::checked, LhsType, RhsType>::type, typename LhsType::error_policy> type;
+		};
+
+		template<stdint::intmax_t ResultMin, stdint::intmax_t ResultMax, typename LhsType, typename RhsType>
+		struct RangedResult<ResultMin, ResultMax, LhsType, RhsType, false> {};
+
+		template<typename LhsType, typename RhsType>
+		struct RangedSum : RangedResult < stdint::intmax_t(LhsType::min_val) + RhsType::min_val,
+		        stdint::intmax_t(LhsType::max_val) + RhsType::max_val, LhsType, RhsType > {};
+
+		template<typename LhsType, typename RhsType>
+		struct RangedDifference : RangedResult < stdint::intmax_t(LhsType::min_val) - RhsType::max_val,
+		        stdint::intmax_t(LhsType::max_val) - RhsType::min_val, LhsType, RhsType > {};
+
+		template<typename LhsType, typename RhsType>
+		struct RangedProductBounds {
+			static const stdint::intmax_t a = stdint::intmax_t(LhsType::min_val) * RhsType::min_val;
+			static const stdint::intmax_t b = stdint::intmax_t(LhsType::min_val) * RhsType::max_val;
+			static const stdint::intmax_t c = stdint::intmax_t(LhsType::max_val) * RhsType::min_val;
+			static const stdint::intmax_t d = stdint::intmax_t(LhsType::max_val) * RhsType::max_val;
+			static const stdint::intmax_t min_val = StaticMin<StaticMin<a, b>::value, StaticMin<c, d>::value>::value;
+			static const stdint::intmax_t max_val = StaticMax<StaticMax<a, b>::value, StaticMax<c, d>::value>::value;
+		};
+
+		template<typename LhsType, typename RhsType>
+		struct RangedProduct : RangedResult < RangedProductBounds<LhsType, RhsType>::min_val,
+		        RangedProductBounds<LhsType, RhsType>::max_val, LhsType, RhsType > {};
+
+		template<typename Type>
+		struct RangedNegation : RangedResult < -stdint::intmax_t(Type::max_val), -stdint::intmax_t(Type::min_val), Type, Type > {};
 	} // end of namespace detail
 
 /// @addtogroup DataStructures Data Structures
@@ -118,6 +207,12 @@ namespace util {
 
 	/// A lightweight container template for integer values from a compile-time-defined range,
 	/// with range checking and error handling as policy classes.
+	///
+	/// Values are stored in the narrowest integer type that holds the range
+	/// (so RangedInt<0, 7> is one byte, whatever the checking policy), and
+	/// checked as int before being narrowed. With an unchecked policy,
+	/// keeping values in range is a precondition: an out-of-range value is
+	/// narrowed into storage and cannot be recovered or caught later.
 	/// @todo static assert that minVal <= maxVal
 	template<int MinVal, int MaxVal, typename CheckingPolicy = AlwaysCheck, typename ErrorPolicy = ThrowOutOfRange>
 	class RangedInt {
@@ -127,17 +222,20 @@ namespace util {
 			static const int max_val = MaxVal;
 
 			typedef RangedInt<MinVal, MaxVal, CheckingPolicy, ErrorPolicy> self_type;
+			typedef CheckingPolicy checking_policy;
+			typedef ErrorPolicy error_policy;
+			typedef typename detail::RangedIntStorage<MinVal, MaxVal>::type storage_type;
 
 		private:
-			int value;
-			void _rangeCheck() const {
-				detail::DoRangeCheck<checked, MinVal, MaxVal, ErrorPolicy>::check(value);
+			storage_type value;
+			static void _rangeCheck(int v) {
+				detail::DoRangeCheck<checked, MinVal, MaxVal, ErrorPolicy>::check(v);
 			}
 
 			template<typename SrcType>
-			void _crossRangeCheck(SrcType const&) {
-				detail::CheckMin < (checked && ((SrcType::min_val < MinVal) || !SrcType::checked)), MinVal, ErrorPolicy >::check(value);
-				detail::CheckMax < (checked && ((SrcType::max_val > MaxVal) || !SrcType::checked)), MaxVal, ErrorPolicy >::check(value);
+			static void _crossRangeCheck(SrcType const& src) {
+				detail::CheckMin < (checked && ((SrcType::min_val < MinVal) || !SrcType::checked)), MinVal, ErrorPolicy >::check(int(src));
+				detail::CheckMax < (checked && ((SrcType::max_val > MaxVal) || !SrcType::checked)), MaxVal, ErrorPolicy >::check(int(src));
 			}
 
 		public:
@@ -146,10 +244,15 @@ namespace util {
 			}
 
 			RangedInt(int v)
-				: value(v) {
-				_rangeCheck();
+				: value(static_cast<storage_type>(v)) {
+				_rangeCheck(v);
 			}
 
+			/// @brief Construct from a value the caller has proven is in range,
+			/// without checking.
+			RangedInt(int v, detail::KnownInRange)
+				: value(static_cast<storage_type>(v)) {}
+
 			RangedInt(self_type const& other)
 				: value(other.value) {
 				/* known ok, copy from same type */
@@ -157,13 +260,13 @@ namespace util {
 
 			template<int SrcMin, int SrcMax, typename SrcCheckingPolicy, typename SrcErrorPolicy>
 			RangedInt(RangedInt<SrcMin, SrcMax, SrcCheckingPolicy, SrcErrorPolicy> const& other)
-				: value(int(other)) {
+				: value(static_cast<storage_type>(int(other))) {
 				_crossRangeCheck(other);
 			}
 
 			self_type & operator=(int v) {
-				value = v;
-				_rangeCheck();
+				_rangeCheck(v);
+				value = static_cast<storage_type>(v);
 				return *this;
 			}
 
@@ -175,12 +278,85 @@ namespace util {
 
 			template<int SrcMin, int SrcMax, typename SrcCheckingPolicy, typename SrcErrorPolicy>
 			self_type & operator=(RangedInt<SrcMin, SrcMax, SrcCheckingPolicy, SrcErrorPolicy> const& other) {
-				value = int(other);
 				_crossRangeCheck(other);
+				value = static_cast<storage_type>(int(other));
 				return *this;
 			}
+
+			/// @name Compound assignment
+			/// The result is checked against this range, unless the range of
+			/// the operation's result provably fits within it.
+			/// @{
+			template<int SrcMin, int SrcMax, typename SrcCheckingPolicy, typename SrcErrorPolicy>
+			self_type & operator+=(RangedInt<SrcMin, SrcMax, SrcCheckingPolicy, SrcErrorPolicy> const& other) {
+				return *this = *this + other;
+			}
+
+			template<int SrcMin, int SrcMax, typename SrcCheckingPolicy, typename SrcErrorPolicy>
+			self_type & operator-=(RangedInt<SrcMin, SrcMax, SrcCheckingPolicy, SrcErrorPolicy> const& other) {
+				return *this = *this - other;
+			}
+
+			template<int SrcMin, int SrcMax, typename SrcCheckingPolicy, typename SrcErrorPolicy>
+			self_type & operator*=(RangedInt<SrcMin, SrcMax, SrcCheckingPolicy, SrcErrorPolicy> const& other) {
+				return *this = *this * other;
+			}
+
+			self_type & operator+=(int v) {
+				return *this = value + v;
+			}
+
+			self_type & operator-=(int v) {
+				return *this = value - v;
+			}
+
+			self_type & operator*=(int v) {
+				return *this = value * v;
+			}
+			/// @}
 	};
 
+	/// @name Arithmetic between ranged ints
+	/// The result range is computed at compile time from the operand
+	/// ranges, so no runtime check is needed to produce it, and assigning
+	/// it into a range that contains it is unchecked as well. Arithmetic
+	/// with a plain int still decays to int, and so does arithmetic whose
+	/// result range does not fit in int: those operators drop out of
+	/// overload resolution.
+	///
+	/// The operators compute in int, which cannot overflow because the
+	/// result range fits in int. That relies on the operands holding values
+	/// in their ranges, which an unchecked operand must by precondition.
+	/// @{
+	template<int LhsMin, int LhsMax, typename LhsCheckingPolicy, typename LhsErrorPolicy, int RhsMin, int RhsMax, typename RhsCheckingPolicy, typename RhsErrorPolicy>
+	inline typename detail::RangedSum<RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy>, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> >::type
+	operator+(RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy> const& lhs, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> const& rhs) {
+		typedef typename detail::RangedSum<RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy>, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> >::type result_type;
+		return result_type(int(lhs) + int(rhs), detail::KnownInRange());
+	}
+
+	template<int LhsMin, int LhsMax, typename LhsCheckingPolicy, typename LhsErrorPolicy, int RhsMin, int RhsMax, typename RhsCheckingPolicy, typename RhsErrorPolicy>
+	inline typename detail::RangedDifference<RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy>, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> >::type
+	operator-(RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy> const& lhs, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> const& rhs) {
+		typedef typename detail::RangedDifference<RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy>, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> >::type result_type;
+		return result_type(int(lhs) - int(rhs), detail::KnownInRange());
+	}
+
+	template<int LhsMin, int LhsMax, typename LhsCheckingPolicy, typename LhsErrorPolicy, int RhsMin, int RhsMax, typename RhsCheckingPolicy, typename RhsErrorPolicy>
+	inline typename detail::RangedProduct<RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy>, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> >::type
+	operator*(RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy> const& lhs, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> const& rhs) {
+		typedef typename detail::RangedProduct<RangedInt<LhsMin, LhsMax, LhsCheckingPolicy, LhsErrorPolicy>, RangedInt<RhsMin, RhsMax, RhsCheckingPolicy, RhsErrorPolicy> >::type result_type;
+		return result_type(int(lhs) * int(rhs), detail::KnownInRange());
+	}
+
+	template<int MinVal, int MaxVal, typename CheckingPolicy, typename ErrorPolicy>
+	inline typename detail::RangedNegation<RangedInt<MinVal, MaxVal, CheckingPolicy, ErrorPolicy> >::type
+	operator-(RangedInt<MinVal, MaxVal, CheckingPolicy, ErrorPolicy> const& v) {
+		typedef typename detail::RangedNegation<RangedInt<MinVal, MaxVal, CheckingPolicy, ErrorPolicy> >::type result_type;
+		return result_type(-int(v), detail::KnownInRange());
+	}
+	/// @}
+
 
 } // end of namespace util
 
@@ -0,0 +1,64 @@
+/** @file
+	@brief Helpers for opening and mapping a whole file read-only, shared
+	by the memory-mapped readers, that report failure as
+	std::runtime_error rather than as a Boost.Interprocess exception.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_ReadOnlyFileMapping_h_GUID_dfa08471_0def_41ce_8c5b_8fef6e130756
+#define INCLUDED_ReadOnlyFileMapping_h_GUID_dfa08471_0def_41ce_8c5b_8fef6e130756
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+// Standard includes
+#include <string>
+#include <stdexcept>
+
+namespace util {
+	namespace detail {
+		/// @internal
+		/// @brief Opens @p filename for read-only mapping; @p what names
+		/// the kind of file in the error message.
+		inline boost::interprocess::file_mapping openReadOnlyFile(std::string const& filename, std::string const& what) {
+			try {
+				return boost::interprocess::file_mapping(filename.c_str(), boost::interprocess::read_only);
+			} catch (boost::interprocess::interprocess_exception &) {
+				throw std::runtime_error("Could not open " + what + " file: " + filename);
+			}
+		}
+
+		/// @internal
+		/// @brief Maps all of @p file read-only. An empty file cannot be
+		/// mapped at all, so this throws for one.
+		inline boost::interprocess::mapped_region mapReadOnlyFile(boost::interprocess::file_mapping const& file, std::string const& filename, std::string const& what) {
+			try {
+				return boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+			} catch (boost::interprocess::interprocess_exception &) {
+				throw std::runtime_error("Could not map " + what + " file: " + filename);
+			}
+		}
+	} // end of namespace detail
+} // end of namespace util
+
+#endif // INCLUDED_ReadOnlyFileMapping_h_GUID_dfa08471_0def_41ce_8c5b_8fef6e130756
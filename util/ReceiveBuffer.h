@@ -294,7 +294,7 @@ namespace util {
 
 
 			/// @brief Adapt a buffer index into an index in the wrapped container
-			size_type adjusted_index(size_type i) {
+			size_type adjusted_index(size_type i) const {
 				return _begin + i;
 			}
 
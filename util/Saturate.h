@@ -30,10 +30,32 @@
 #include <Eigen/Core>
 
 // Standard includes
-// - none
+#include <cmath>
 
 namespace util {
 
+	namespace detail {
+		/// @internal
+		/// @brief Scale factor that saturates a vector with the given squared
+		/// norm, or 1 if it is within range: computed unconditionally and
+		/// then selected, so the compiler can emit a conditional move or
+		/// blend instead of a branch.
+		template<typename Scalar>
+		inline Scalar saturateScale(Scalar squaredNorm, Scalar maxMagnitude, Scalar maxSquared, bool & saturated) {
+			saturated = squaredNorm > maxSquared;
+			const Scalar reduction = maxMagnitude / std::sqrt(squaredNorm);
+			return saturated ? reduction : Scalar(1);
+		}
+
+		/// @internal
+		/// @brief Clamp one component to [-limit, limit] without branching.
+		template<typename Scalar>
+		inline Scalar saturateClampAxis(Scalar v, Scalar limit) {
+			const Scalar lowered = v > limit ? limit : v;
+			return lowered < -limit ? -limit : lowered;
+		}
+	} // end of namespace detail
+
 /// @addtogroup Math Math Utilities
 /// @{
 
@@ -79,6 +101,98 @@ namespace util {
 		return false;
 	}
 
+	/** Saturate any fixed-size vector (or matrix, by its Frobenius norm) at
+		the given max magnitude: the generic form of the Vector3d overload,
+		for e.g. Vector2d, Vector4f or 6-DOF wrenches.
+
+		Accepts writable expressions such as blocks and segments as well as
+		plain vectors. The size is known at compile time, so the norm is
+		fully unrolled and, for sizes that fill a SIMD packet such as
+		Vector4f, vectorized by Eigen.
+
+		@returns true if this vector was saturated.
+	*/
+	template<typename Derived>
+	inline bool saturate(Eigen::MatrixBase<Derived> const& vec, typename Derived::Scalar const maxMagnitude) {
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(Derived);
+		typedef typename Derived::Scalar Scalar;
+		bool saturated;
+		const Scalar scale = detail::saturateScale(vec.squaredNorm(), maxMagnitude, maxMagnitude * maxMagnitude, saturated);
+		vec.const_cast_derived() *= scale;
+		return saturated;
+	}
+
+	/** Saturate any fixed-size vector at the given max magnitude, scaling
+		the paired @paramref otherVec in the same proportion: the generic
+		form of the Vector3d overload.
+
+		@returns true if this vector was saturated.
+	*/
+	template<typename Derived, typename OtherDerived>
+	inline bool saturate(Eigen::MatrixBase<Derived> const& vec, typename Derived::Scalar const maxMagnitude, Eigen::MatrixBase<OtherDerived> const& otherVec) {
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(Derived);
+		typedef typename Derived::Scalar Scalar;
+		bool saturated;
+		const Scalar scale = detail::saturateScale(vec.squaredNorm(), maxMagnitude, maxMagnitude * maxMagnitude, saturated);
+		vec.const_cast_derived() *= scale;
+		otherVec.const_cast_derived() *= scale;
+		return saturated;
+	}
+
+	/** Limit each component of a fixed-size vector to
+		[-@paramref maxPerAxis, @paramref maxPerAxis], and then its total
+		magnitude to @paramref maxMagnitude, in one pass: the squared norm
+		is accumulated from the clamped components as they are written.
+
+		@returns true if any component was clamped or the vector was
+		saturated.
+	*/
+	template<typename Derived>
+	inline bool saturatePerAxis(Eigen::MatrixBase<Derived> const& vec, typename Derived::Scalar const maxPerAxis, typename Derived::Scalar const maxMagnitude) {
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(Derived);
+		EIGEN_STATIC_ASSERT_VECTOR_ONLY(Derived);
+		typedef typename Derived::Scalar Scalar;
+		Derived & v = vec.const_cast_derived();
+		Scalar squaredNorm(0);
+		bool clamped = false;
+		for (int i = 0; i < Derived::SizeAtCompileTime; ++i) {
+			const Scalar c = detail::saturateClampAxis(v[i], maxPerAxis);
+			clamped = clamped || (c != v[i]);
+			v[i] = c;
+			squaredNorm += c * c;
+		}
+		bool saturated;
+		v *= detail::saturateScale(squaredNorm, maxMagnitude, maxMagnitude * maxMagnitude, saturated);
+		return clamped || saturated;
+	}
+
+	/** Limit each component of a fixed-size vector to the matching entry of
+		@paramref maxPerAxis (e.g. separate force and torque limits for a
+		wrench), and then its total magnitude, in one pass.
+
+		@returns true if any component was clamped or the vector was
+		saturated.
+	*/
+	template<typename Derived, typename LimitDerived>
+	inline bool saturatePerAxis(Eigen::MatrixBase<Derived> const& vec, Eigen::MatrixBase<LimitDerived> const& maxPerAxis, typename Derived::Scalar const maxMagnitude) {
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(Derived);
+		EIGEN_STATIC_ASSERT_VECTOR_ONLY(Derived);
+		EIGEN_STATIC_ASSERT_SAME_VECTOR_SIZE(Derived, LimitDerived);
+		typedef typename Derived::Scalar Scalar;
+		Derived & v = vec.const_cast_derived();
+		Scalar squaredNorm(0);
+		bool clamped = false;
+		for (int i = 0; i < Derived::SizeAtCompileTime; ++i) {
+			const Scalar c = detail::saturateClampAxis(v[i], Scalar(maxPerAxis[i]));
+			clamped = clamped || (c != v[i]);
+			v[i] = c;
+			squaredNorm += c * c;
+		}
+		bool saturated;
+		v *= detail::saturateScale(squaredNorm, maxMagnitude, maxMagnitude * maxMagnitude, saturated);
+		return clamped || saturated;
+	}
+
 /// @}
 
 }
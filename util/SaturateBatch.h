@@ -0,0 +1,331 @@
+/** @file
+	@brief Vector saturation over whole arrays of vectors, in
+	structure-of-arrays or array-of-structures layout.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_SaturateBatch_h_GUID_d001829b_e85c_40a4_969d_eb85383f9042
+#define INCLUDED_SaturateBatch_h_GUID_d001829b_e85c_40a4_969d_eb85383f9042
+
+// Internal Includes
+#include <util/Saturate.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+
+// Standard includes
+#include <cstddef>
+#include <algorithm>
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTIL_SATURATEBATCH_SSE2
+#endif
+
+namespace util {
+
+	namespace detail {
+		/// @internal
+		/// @brief Records the saturation flags of entries i and following
+		/// in a bitmask, if any.
+		inline void saturateSetMaskBits(stdint::uint64_t * mask, std::size_t i, stdint::uint64_t bits) {
+			if (mask) {
+				mask[i / 64] |= bits << (i % 64);
+			}
+		}
+
+		/// @internal
+		/// @brief Number of set bits in a lane mask
+		inline std::size_t saturateBitCount(int bits) {
+			std::size_t count = 0;
+			for (; bits; bits &= bits - 1) {
+				++count;
+			}
+			return count;
+		}
+
+#if defined(__AVX__) || defined(UTIL_SATURATEBATCH_SSE2)
+#define UTIL_SATURATEBATCH_PACKETS
+		/// @internal
+		/// @brief The SIMD operations used by the structure-of-arrays kernel,
+		/// for each scalar type.
+		template<typename Scalar>
+		struct SaturatePacket;
+#endif
+
+#if defined(__AVX__)
+		template<>
+		struct SaturatePacket<double> {
+			typedef __m256d type;
+			enum { Size = 4 };
+			static type set1(double v) { return _mm256_set1_pd(v); }
+			static type load(double const* p) { return _mm256_loadu_pd(p); }
+			static void store(double * p, type v) { _mm256_storeu_pd(p, v); }
+			static type add(type a, type b) { return _mm256_add_pd(a, b); }
+			static type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+			static type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+			static type div(type a, type b) { return _mm256_div_pd(a, b); }
+			static type sqrt(type a) { return _mm256_sqrt_pd(a); }
+			static type min(type a, type b) { return _mm256_min_pd(a, b); }
+			/// There is no double-precision estimate instruction
+			static type rsqrt(type a) { return div(set1(1.0), sqrt(a)); }
+			static type greater(type a, type b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+			static type select(type mask, type ifTrue, type ifFalse) { return _mm256_blendv_pd(ifFalse, ifTrue, mask); }
+			static int movemask(type mask) { return _mm256_movemask_pd(mask); }
+		};
+
+		template<>
+		struct SaturatePacket<float> {
+			typedef __m256 type;
+			enum { Size = 8 };
+			static type set1(float v) { return _mm256_set1_ps(v); }
+			static type load(float const* p) { return _mm256_loadu_ps(p); }
+			static void store(float * p, type v) { _mm256_storeu_ps(p, v); }
+			static type add(type a, type b) { return _mm256_add_ps(a, b); }
+			static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+			static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+			static type div(type a, type b) { return _mm256_div_ps(a, b); }
+			static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+			static type min(type a, type b) { return _mm256_min_ps(a, b); }
+			/// Hardware estimate refined by one Newton-Raphson step
+			static type rsqrt(type a) {
+				const type y = _mm256_rsqrt_ps(a);
+				return mul(y, sub(set1(1.5f), mul(mul(set1(0.5f), a), mul(y, y))));
+			}
+			static type greater(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+			static type select(type mask, type ifTrue, type ifFalse) { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+			static int movemask(type mask) { return _mm256_movemask_ps(mask); }
+		};
+#elif defined(UTIL_SATURATEBATCH_SSE2)
+		/// SSE2 has no blend instruction: select with and/andnot/or
+		template<>
+		struct SaturatePacket<double> {
+			typedef __m128d type;
+			enum { Size = 2 };
+			static type set1(double v) { return _mm_set1_pd(v); }
+			static type load(double const* p) { return _mm_loadu_pd(p); }
+			static void store(double * p, type v) { _mm_storeu_pd(p, v); }
+			static type add(type a, type b) { return _mm_add_pd(a, b); }
+			static type sub(type a, type b) { return _mm_sub_pd(a, b); }
+			static type mul(type a, type b) { return _mm_mul_pd(a, b); }
+			static type div(type a, type b) { return _mm_div_pd(a, b); }
+			static type sqrt(type a) { return _mm_sqrt_pd(a); }
+			static type min(type a, type b) { return _mm_min_pd(a, b); }
+			/// There is no double-precision estimate instruction
+			static type rsqrt(type a) { return div(set1(1.0), sqrt(a)); }
+			static type greater(type a, type b) { return _mm_cmpgt_pd(a, b); }
+			static type select(type mask, type ifTrue, type ifFalse) { return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse)); }
+			static int movemask(type mask) { return _mm_movemask_pd(mask); }
+		};
+
+		template<>
+		struct SaturatePacket<float> {
+			typedef __m128 type;
+			enum { Size = 4 };
+			static type set1(float v) { return _mm_set1_ps(v); }
+			static type load(float const* p) { return _mm_loadu_ps(p); }
+			static void store(float * p, type v) { _mm_storeu_ps(p, v); }
+			static type add(type a, type b) { return _mm_add_ps(a, b); }
+			static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+			static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+			static type div(type a, type b) { return _mm_div_ps(a, b); }
+			static type sqrt(type a) { return _mm_sqrt_ps(a); }
+			static type min(type a, type b) { return _mm_min_ps(a, b); }
+			/// Hardware estimate refined by one Newton-Raphson step
+			static type rsqrt(type a) {
+				const type y = _mm_rsqrt_ps(a);
+				return mul(y, sub(set1(1.5f), mul(mul(set1(0.5f), a), mul(y, y))));
+			}
+			static type greater(type a, type b) { return _mm_cmpgt_ps(a, b); }
+			static type select(type mask, type ifTrue, type ifFalse) { return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse)); }
+			static int movemask(type mask) { return _mm_movemask_ps(mask); }
+		};
+#endif
+
+		/// @internal
+		/// @brief Structure-of-arrays kernel: with Paired, scales the "other"
+		/// arrays by the same factor.
+		template<typename Scalar, bool Paired>
+		inline std::size_t saturateSoAKernel(Scalar * x, Scalar * y, Scalar * z,
+		                                     Scalar * ox, Scalar * oy, Scalar * oz,
+		                                     std::size_t n, Scalar maxMagnitude, stdint::uint64_t * mask) {
+			if (mask) {
+				std::fill(mask, mask + (n + 63) / 64, stdint::uint64_t(0));
+			}
+			const Scalar maxSquared = maxMagnitude * maxMagnitude;
+			std::size_t count = 0;
+			std::size_t i = 0;
+#ifdef UTIL_SATURATEBATCH_PACKETS
+			{
+				typedef SaturatePacket<Scalar> P;
+				typedef typename P::type Packet;
+				const Packet vMax = P::set1(maxMagnitude);
+				const Packet vMaxSquared = P::set1(maxSquared);
+				const Packet vOne = P::set1(Scalar(1));
+				for (; i + P::Size <= n; i += P::Size) {
+					const Packet vx = P::load(x + i);
+					const Packet vy = P::load(y + i);
+					const Packet vz = P::load(z + i);
+					const Packet sq = P::add(P::add(P::mul(vx, vx), P::mul(vy, vy)), P::mul(vz, vz));
+					const Packet over = P::greater(sq, vMaxSquared);
+					const Packet scale = P::select(over, P::div(vMax, P::sqrt(sq)), vOne);
+					P::store(x + i, P::mul(vx, scale));
+					P::store(y + i, P::mul(vy, scale));
+					P::store(z + i, P::mul(vz, scale));
+					if (Paired) {
+						P::store(ox + i, P::mul(P::load(ox + i), scale));
+						P::store(oy + i, P::mul(P::load(oy + i), scale));
+						P::store(oz + i, P::mul(P::load(oz + i), scale));
+					}
+					const int bits = P::movemask(over);
+					count += saturateBitCount(bits);
+					saturateSetMaskBits(mask, i, stdint::uint64_t(bits));
+				}
+			}
+#endif
+			for (; i < n; ++i) {
+				bool saturated;
+				const Scalar scale = saturateScale(x[i] * x[i] + y[i] * y[i] + z[i] * z[i], maxMagnitude, maxSquared, saturated);
+				x[i] *= scale;
+				y[i] *= scale;
+				z[i] *= scale;
+				if (Paired) {
+					ox[i] *= scale;
+					oy[i] *= scale;
+					oz[i] *= scale;
+				}
+				count += saturated;
+				saturateSetMaskBits(mask, i, saturated);
+			}
+			return count;
+		}
+
+		/// @internal
+		/// @brief Array-of-structures kernel: a branch-free loop over the
+		/// generic fixed-size saturate(), since small vectors do not fill
+		/// SIMD lanes without a transpose.
+		template<typename VectorType, bool Paired>
+		inline std::size_t saturateAoSKernel(VectorType * vecs, VectorType * others,
+		                                     std::size_t n, typename VectorType::Scalar maxMagnitude, stdint::uint64_t * mask) {
+			typedef typename VectorType::Scalar Scalar;
+			if (mask) {
+				std::fill(mask, mask + (n + 63) / 64, stdint::uint64_t(0));
+			}
+			const Scalar maxSquared = maxMagnitude * maxMagnitude;
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				bool saturated;
+				const Scalar scale = saturateScale(vecs[i].squaredNorm(), maxMagnitude, maxSquared, saturated);
+				vecs[i] *= scale;
+				if (Paired) {
+					others[i] *= scale;
+				}
+				count += saturated;
+				saturateSetMaskBits(mask, i, saturated);
+			}
+			return count;
+		}
+	} // end of namespace detail
+
+/// @addtogroup Math Math Utilities
+/// @{
+
+	/** Number of 64-bit words needed for a saturation bitmask of n entries. */
+	inline std::size_t saturateMaskWords(std::size_t n) {
+		return (n + 63) / 64;
+	}
+
+	/** Saturate each of n vectors stored as separate x, y and z arrays at
+		the given max magnitude, as util::saturate() does for one vector.
+
+		This layout is processed several vectors at a time with SIMD
+		instructions where available (AVX, then SSE2), with a per-lane blend
+		in place of the branch. Float arrays are also accepted.
+
+		@param mask if not NULL, an array of saturateMaskWords(n) words that
+		is overwritten so that bit (i % 64) of word (i / 64) is set if and
+		only if vector i was saturated.
+
+		@returns the number of vectors that were saturated.
+	*/
+	inline std::size_t saturateSoA(double * x, double * y, double * z, std::size_t n,
+	                               double const maxMagnitude, stdint::uint64_t * mask = NULL) {
+		return detail::saturateSoAKernel<double, false>(x, y, z, NULL, NULL, NULL, n, maxMagnitude, mask);
+	}
+
+	/** Single-precision version of saturateSoA(), processing twice as many
+		vectors per SIMD instruction.
+	*/
+	inline std::size_t saturateSoA(float * x, float * y, float * z, std::size_t n,
+	                               float const maxMagnitude, stdint::uint64_t * mask = NULL) {
+		return detail::saturateSoAKernel<float, false>(x, y, z, NULL, NULL, NULL, n, maxMagnitude, mask);
+	}
+
+	/** Saturate each of n vectors stored as separate x, y and z arrays at
+		the given max magnitude, scaling the paired "other" vectors in the
+		same proportion, as util::saturate() does with otherVec.
+
+		@returns the number of vectors that were saturated.
+	*/
+	inline std::size_t saturateSoA(double * x, double * y, double * z,
+	                               double * otherX, double * otherY, double * otherZ, std::size_t n,
+	                               double const maxMagnitude, stdint::uint64_t * mask = NULL) {
+		return detail::saturateSoAKernel<double, true>(x, y, z, otherX, otherY, otherZ, n, maxMagnitude, mask);
+	}
+
+	/** Single-precision version of the paired saturateSoA() */
+	inline std::size_t saturateSoA(float * x, float * y, float * z,
+	                               float * otherX, float * otherY, float * otherZ, std::size_t n,
+	                               float const maxMagnitude, stdint::uint64_t * mask = NULL) {
+		return detail::saturateSoAKernel<float, true>(x, y, z, otherX, otherY, otherZ, n, maxMagnitude, mask);
+	}
+
+	/** Saturate each of an array of n fixed-size vectors (of any dimension
+		and scalar type) at the given max magnitude.
+
+		@param mask optional saturation bitmask, as in saturateSoA()
+
+		@returns the number of vectors that were saturated.
+	*/
+	template<typename VectorType>
+	inline std::size_t saturateAoS(VectorType * vecs, std::size_t n,
+	                               typename VectorType::Scalar const maxMagnitude, stdint::uint64_t * mask = NULL) {
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(VectorType);
+		return detail::saturateAoSKernel<VectorType, false>(vecs, NULL, n, maxMagnitude, mask);
+	}
+
+	/** Saturate each of an array of n vectors at the given max magnitude,
+		scaling the paired "other" vectors in the same proportion.
+
+		@returns the number of vectors that were saturated.
+	*/
+	template<typename VectorType>
+	inline std::size_t saturateAoS(VectorType * vecs, VectorType * otherVecs, std::size_t n,
+	                               typename VectorType::Scalar const maxMagnitude, stdint::uint64_t * mask = NULL) {
+		EIGEN_STATIC_ASSERT_FIXED_SIZE(VectorType);
+		return detail::saturateAoSKernel<VectorType, true>(vecs, otherVecs, n, maxMagnitude, mask);
+	}
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_SaturateBatch_h_GUID_d001829b_e85c_40a4_969d_eb85383f9042
@@ -24,16 +24,73 @@
 #define INCLUDED_Set2_h_GUID_cfb4b70a_f756_4367_b64f_f76f4569deda
 
 // Internal Includes
-// - none
+#include <util/booststdint.h>
 
 // Library/third-party includes
-// - none
+#include <boost/config.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
 
 // Standard includes
 #include <algorithm>
+#include <cstddef>
+#if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)
+#include <functional>
+#endif
 
 namespace util {
 
+	namespace detail {
+		/// @internal
+		/// @brief Whether PackedSet2 can hold this type in a single
+		/// 64-bit word: integral types (other than bool) of 32 bits or fewer.
+		template<typename T>
+		struct Set2IsPackable {
+			static const bool value = boost::is_integral<T>::value
+			                          && !boost::is_same<T, bool>::value
+			                          && sizeof(T) <= 4;
+		};
+
+		/// @internal
+		/// @brief Order-preserving mapping between a packable integral type
+		/// and a 32-bit unsigned integer: signed values are biased so that
+		/// unsigned comparison gives the same order.
+		template<typename T, bool IsSigned = boost::is_signed<T>::value>
+		struct Set2OrderedBits {
+			static stdint::uint32_t to(T v) {
+				return static_cast<stdint::uint32_t>(static_cast<stdint::int32_t>(v)) ^ 0x80000000u;
+			}
+			static T from(stdint::uint32_t u) {
+				return static_cast<T>(static_cast<stdint::int32_t>(u ^ 0x80000000u));
+			}
+		};
+
+		template<typename T>
+		struct Set2OrderedBits<T, false> {
+			static stdint::uint32_t to(T v) {
+				return static_cast<stdint::uint32_t>(v);
+			}
+			static T from(stdint::uint32_t u) {
+				return static_cast<T>(u);
+			}
+		};
+
+		/// @internal
+		/// @brief 64-bit finalizer (from MurmurHash3) to spread packed keys
+		/// over all bits before they are reduced to a bucket index.
+		inline std::size_t set2MixKey(stdint::uint64_t k) {
+			k ^= k >> 33;
+			k *= 0xff51afd7ed558ccdULL;
+			k ^= k >> 33;
+			k *= 0xc4ceb9fe1a85ec53ULL;
+			k ^= k >> 33;
+			return static_cast<std::size_t>(k);
+		}
+	} // end of namespace detail
+
 /// @addtogroup DataStructures Data Structures
 /// @{
 
@@ -49,6 +106,8 @@ namespace util {
 
 		@tparam T Contained type.
 
+		@see PackedSet2 for a single-word representation of small integral types.
+
 		@todo How to enforce a single representation for cases in which
 		! (a < b) but also ! (b < a), but a != b in some meaningful way?
 
@@ -114,6 +173,88 @@ namespace util {
 			T _second;
 	};
 
+	/** @brief Set2 of a small integral type, packed into a single 64-bit key.
+
+		The ordered pair is stored with the smaller element in the high
+		word, so that ordering, equality and hashing are each a single
+		integer operation. The key is order-preserving: comparing keys gives
+		the same result as comparing the equivalent Set2 values.
+
+		Accessors return by value rather than by reference.
+
+		@tparam T An integral type (other than bool) of 32 bits or fewer.
+	*/
+	template<typename T>
+	class PackedSet2 {
+		private:
+			typedef detail::Set2OrderedBits<T> bits;
+		public:
+			BOOST_STATIC_ASSERT_MSG(detail::Set2IsPackable<T>::value, "PackedSet2 requires an integral type of 32 bits or fewer");
+
+			/// Contained value type
+			typedef T value_type;
+
+			/// Packed key type
+			typedef stdint::uint64_t key_type;
+
+			/// Default constructor: both elements value-initialized
+			PackedSet2() :
+				_key(_pack(T(), T())) {}
+
+			/// Constructor from values
+			PackedSet2(T a, T b) :
+				_key(_pack(a, b)) {}
+
+			/// Conversion from the unpacked representation
+			PackedSet2(Set2<T> const& other) :
+				_key(_pack(other.first(), other.second())) {}
+
+			/// Mutator: must change both at once to enforce internal order
+			PackedSet2 const& set(T a, T b) {
+				_key = _pack(a, b);
+				return *this;
+			}
+
+			/// Accessor for the "smaller" of the two elements
+			T first() const {
+				return bits::from(static_cast<stdint::uint32_t>(_key >> 32));
+			}
+
+			/// Accessor for the "larger" of the two elements
+			T second() const {
+				return bits::from(static_cast<stdint::uint32_t>(_key));
+			}
+
+			/// Conversion to the unpacked representation
+			Set2<T> unpacked() const {
+				return Set2<T>(first(), second());
+			}
+
+			/// Accessor for the packed key: keys compare in the same order
+			/// as the values they represent.
+			key_type key() const {
+				return _key;
+			}
+
+			/// Reconstruct a PackedSet2 from a key previously returned by key()
+			static PackedSet2 fromKey(key_type k) {
+				PackedSet2 ret;
+				ret._key = k;
+				return ret;
+			}
+
+		private:
+			static key_type _pack(T a, T b) {
+				const stdint::uint32_t ua = bits::to(a);
+				const stdint::uint32_t ub = bits::to(b);
+				const stdint::uint32_t lo = ub < ua ? ub : ua;
+				const stdint::uint32_t hi = ub < ua ? ua : ub;
+				return (key_type(lo) << 32) | hi;
+			}
+
+			key_type _key;
+	};
+
 /// @brief Comparison operator for Set2 containers: uses only operator<
 /// @relates Set2
 	template<typename T>
@@ -129,6 +270,13 @@ namespace util {
 		}
 	}
 
+/// @brief Comparison operator for PackedSet2 containers: compares keys
+/// @relates PackedSet2
+	template<typename T>
+	bool operator<(PackedSet2<T> const& a, PackedSet2<T> const& b) {
+		return a.key() < b.key();
+	}
+
 /// @brief Equality operator for Set2 containers: uses operator==
 /// @relates Set2
 	template<typename T>
@@ -137,9 +285,53 @@ namespace util {
 		return (a.first() == b.first()) && (a.second() == b.second());
 	}
 
+/// @brief Equality operator for PackedSet2 containers: compares keys
+/// @relates PackedSet2
+	template<typename T>
+	bool operator==(PackedSet2<T> const& a, PackedSet2<T> const& b) {
+		return a.key() == b.key();
+	}
+
+/// @brief Hash function for Set2 containers, for use with boost::hash
+/// and boost::unordered containers.
+/// @relates Set2
+	template<typename T>
+	std::size_t hash_value(Set2<T> const& v) {
+		std::size_t seed = 0;
+		boost::hash_combine(seed, v.first());
+		boost::hash_combine(seed, v.second());
+		return seed;
+	}
+
+/// @brief Hash function for PackedSet2 containers: mixes the packed key.
+/// @relates PackedSet2
+	template<typename T>
+	std::size_t hash_value(PackedSet2<T> const& v) {
+		return detail::set2MixKey(v.key());
+	}
+
 /// @}
 
 } // end of namespace util
 
-#endif // INCLUDED_Set2_h_GUID_cfb4b70a_f756_4367_b64f_f76f4569deda
+#if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)
+namespace std {
+	/// @brief std::hash support for Set2, forwarding to util::hash_value
+	template<typename T>
+	struct hash< ::util::Set2<T> > {
+		std::size_t operator()(::util::Set2<T> const& v) const {
+			return ::util::hash_value(v);
+		}
+	};
+
+	/// @brief std::hash support for PackedSet2, forwarding to util::hash_value
+	template<typename T>
+	struct hash< ::util::PackedSet2<T> > {
+		std::size_t operator()(::util::PackedSet2<T> const& v) const {
+			return ::util::hash_value(v);
+		}
+	};
+} // end of namespace std
+#endif
 
+#endif // INCLUDED_Set2_h_GUID_cfb4b70a_f756_4367_b64f_f76f4569deda
@@ -0,0 +1,410 @@
+/** @file
+	@brief Template class for holding N interchangeable elements (such as
+	the vertices of a triangle or tetrahedron) that we nevertheless want
+	to be compatible with STL containers and algos - a generalization of
+	Set2.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_SetN_h_GUID_a486b9c8_ae88_45e2_bc4b_6b9ddd42071a
+#define INCLUDED_SetN_h_GUID_a486b9c8_ae88_45e2_bc4b_6b9ddd42071a
+
+// Internal Includes
+#include <util/Set2.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <boost/config.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <cstddef>
+
+namespace util {
+
+	namespace detail {
+		/// @internal
+		/// @brief Whether a SetN can be packed into a single 64-bit word:
+		/// integral types (other than bool) whose N values fit in 64 bits.
+		template<typename T, int N>
+		struct SetNIsPackable {
+			static const bool value = boost::is_integral<T>::value
+			                          && !boost::is_same<T, bool>::value
+			                          && N * sizeof(T) <= 8;
+		};
+
+		/// @internal
+		/// @brief Order-preserving mapping between an integral type and an
+		/// unsigned value of the same width, zero-extended to 64 bits.
+		template<typename T, bool IsSigned = boost::is_signed<T>::value>
+		struct SetNOrderedBits {
+			typedef typename boost::make_unsigned<T>::type unsigned_type;
+
+			static unsigned_type signBit() {
+				return unsigned_type(unsigned_type(1) << (sizeof(T) * 8 - 1));
+			}
+			static stdint::uint64_t to(T v) {
+				return static_cast<unsigned_type>(static_cast<unsigned_type>(v) ^ signBit());
+			}
+			static T from(stdint::uint64_t u) {
+				return static_cast<T>(static_cast<unsigned_type>(static_cast<unsigned_type>(u) ^ signBit()));
+			}
+		};
+
+		template<typename T>
+		struct SetNOrderedBits<T, false> {
+			static stdint::uint64_t to(T v) {
+				return static_cast<stdint::uint64_t>(v);
+			}
+			static T from(stdint::uint64_t u) {
+				return static_cast<T>(u);
+			}
+		};
+
+		/// @internal
+		/// @brief Compare-exchange written with conditional selects rather
+		/// than branches: for arithmetic types this compiles to min/max or
+		/// conditional-move instructions.
+		template<typename T>
+		inline void compareExchange(T & a, T & b) {
+			const bool swapped = b < a;
+			const T lo = swapped ? b : a;
+			const T hi = swapped ? a : b;
+			a = lo;
+			b = hi;
+		}
+
+		/// @internal
+		/// @brief Sort N values in place using only operator<: optimal
+		/// sorting networks for N up to 4, insertion sort beyond.
+		template<int N>
+		struct SortingNetwork {
+			template<typename T>
+			static void apply(T * v) {
+				for (int i = 1; i < N; ++i) {
+					for (int j = i; j > 0 && v[j] < v[j - 1]; --j) {
+						std::swap(v[j], v[j - 1]);
+					}
+				}
+			}
+		};
+
+		template<>
+		struct SortingNetwork<1> {
+			template<typename T>
+			static void apply(T *) {}
+		};
+
+		template<>
+		struct SortingNetwork<2> {
+			template<typename T>
+			static void apply(T * v) {
+				compareExchange(v[0], v[1]);
+			}
+		};
+
+		template<>
+		struct SortingNetwork<3> {
+			template<typename T>
+			static void apply(T * v) {
+				compareExchange(v[1], v[2]);
+				compareExchange(v[0], v[2]);
+				compareExchange(v[0], v[1]);
+			}
+		};
+
+		template<>
+		struct SortingNetwork<4> {
+			template<typename T>
+			static void apply(T * v) {
+				compareExchange(v[0], v[1]);
+				compareExchange(v[2], v[3]);
+				compareExchange(v[0], v[2]);
+				compareExchange(v[1], v[3]);
+				compareExchange(v[1], v[2]);
+			}
+		};
+	} // end of namespace detail
+
+/// @addtogroup DataStructures Data Structures
+/// @{
+
+	/** @brief Container class for N interchangeable values.
+
+		Like Set2, allows use of a group of values (for instance, the vertex
+		indices of a triangle or tetrahedron) without concern as to what order
+		they are in, for use as keys in maps or for deduplication.
+
+		Values are normalized on construction with a sorting network.
+
+		Should be compatible with most (if not all) STL containers and algorithms.
+
+		@invariant Internally maintains ! ((*this)[i + 1] < (*this)[i])
+
+		@tparam T Contained type.
+		@tparam N Number of elements.
+		@tparam Packed Whether to use a packed 64-bit representation:
+		defaults to true for integral types when all N values fit in 64 bits.
+	*/
+	template<typename T, int N, bool Packed = detail::SetNIsPackable<T, N>::value>
+	class SetN {
+		public:
+			/// Contained value type
+			typedef T value_type;
+			enum {
+				Size = N
+			};
+
+			/// Default constructor: value-initializes all elements
+			SetN() {
+				std::fill(_v, _v + N, T());
+			}
+
+			/// Constructor from two values
+			SetN(T const& a, T const& b) {
+				BOOST_STATIC_ASSERT_MSG(N == 2, "Wrong number of arguments for this SetN size");
+				_v[0] = a;
+				_v[1] = b;
+				detail::SortingNetwork<N>::apply(_v);
+			}
+
+			/// Constructor from three values
+			SetN(T const& a, T const& b, T const& c) {
+				BOOST_STATIC_ASSERT_MSG(N == 3, "Wrong number of arguments for this SetN size");
+				_v[0] = a;
+				_v[1] = b;
+				_v[2] = c;
+				detail::SortingNetwork<N>::apply(_v);
+			}
+
+			/// Constructor from four values
+			SetN(T const& a, T const& b, T const& c, T const& d) {
+				BOOST_STATIC_ASSERT_MSG(N == 4, "Wrong number of arguments for this SetN size");
+				_v[0] = a;
+				_v[1] = b;
+				_v[2] = c;
+				_v[3] = d;
+				detail::SortingNetwork<N>::apply(_v);
+			}
+
+			/// Constructor from an array of N values
+			explicit SetN(T const(&values)[N]) {
+				std::copy(values, values + N, _v);
+				detail::SortingNetwork<N>::apply(_v);
+			}
+
+			/// Accessor for the i'th-smallest element
+			T const& operator[](int i) const {
+				return _v[i];
+			}
+
+			/// Number of elements
+			static int size() {
+				return N;
+			}
+
+		private:
+			T _v[N];
+	};
+
+	/** @brief Packed specialization of SetN for small integral types.
+
+		The sorted values are stored as a single 64-bit key, smallest element
+		in the most significant bits, so that ordering, equality and hashing
+		are each a single integer operation. Comparing keys gives the same
+		result as the lexicographic comparison of the sorted elements.
+
+		Element accessors return by value rather than by reference.
+	*/
+	template<typename T, int N>
+	class SetN<T, N, true> {
+		private:
+			typedef detail::SetNOrderedBits<T> bits;
+			static const int ELEMENT_BITS = sizeof(T) * 8;
+		public:
+			/// Contained value type
+			typedef T value_type;
+
+			/// Packed key type
+			typedef stdint::uint64_t key_type;
+
+			enum {
+				Size = N
+			};
+
+			/// Default constructor: value-initializes all elements
+			SetN() {
+				T v[N];
+				std::fill(v, v + N, T());
+				_pack(v);
+			}
+
+			/// Constructor from two values
+			SetN(T a, T b) {
+				BOOST_STATIC_ASSERT_MSG(N == 2, "Wrong number of arguments for this SetN size");
+				T v[N] = {a, b};
+				detail::SortingNetwork<N>::apply(v);
+				_pack(v);
+			}
+
+			/// Constructor from three values
+			SetN(T a, T b, T c) {
+				BOOST_STATIC_ASSERT_MSG(N == 3, "Wrong number of arguments for this SetN size");
+				T v[N] = {a, b, c};
+				detail::SortingNetwork<N>::apply(v);
+				_pack(v);
+			}
+
+			/// Constructor from four values
+			SetN(T a, T b, T c, T d) {
+				BOOST_STATIC_ASSERT_MSG(N == 4, "Wrong number of arguments for this SetN size");
+				T v[N] = {a, b, c, d};
+				detail::SortingNetwork<N>::apply(v);
+				_pack(v);
+			}
+
+			/// Constructor from an array of N values
+			explicit SetN(T const(&values)[N]) {
+				T v[N];
+				std::copy(values, values + N, v);
+				detail::SortingNetwork<N>::apply(v);
+				_pack(v);
+			}
+
+			/// Accessor for the i'th-smallest element
+			T operator[](int i) const {
+				const int shift = (N - 1 - i) * ELEMENT_BITS;
+				return bits::from((_key >> shift) & _elementMask());
+			}
+
+			/// Number of elements
+			static int size() {
+				return N;
+			}
+
+			/// Accessor for the packed key: keys compare in the same order
+			/// as the SetN values they represent.
+			key_type key() const {
+				return _key;
+			}
+
+			/// Reconstruct a SetN from a key previously returned by key()
+			static SetN fromKey(key_type k) {
+				SetN ret;
+				ret._key = k;
+				return ret;
+			}
+
+		private:
+			static key_type _elementMask() {
+				return ELEMENT_BITS >= 64 ? ~key_type(0) : ((key_type(1) << (ELEMENT_BITS % 64)) - 1);
+			}
+
+			void _pack(T const * v) {
+				_key = 0;
+				for (int i = 0; i < N; ++i) {
+					_key = (ELEMENT_BITS >= 64 ? 0 : (_key << (ELEMENT_BITS % 64))) | bits::to(v[i]);
+				}
+			}
+
+			key_type _key;
+	};
+
+/// @brief Comparison operator for SetN containers: lexicographic, uses only operator<
+/// @relates SetN
+	template<typename T, int N>
+	bool operator<(SetN<T, N, false> const& a, SetN<T, N, false> const& b) {
+		for (int i = 0; i < N; ++i) {
+			if (a[i] < b[i]) {
+				return true;
+			} else if (b[i] < a[i]) {
+				return false;
+			}
+		}
+		return false;
+	}
+
+/// @brief Comparison operator for packed SetN containers: compares keys
+/// @relates SetN
+	template<typename T, int N>
+	bool operator<(SetN<T, N, true> const& a, SetN<T, N, true> const& b) {
+		return a.key() < b.key();
+	}
+
+/// @brief Equality operator for SetN containers: uses operator==
+/// @relates SetN
+	template<typename T, int N>
+	bool operator==(SetN<T, N, false> const& a, SetN<T, N, false> const& b) {
+		for (int i = 0; i < N; ++i) {
+			if (!(a[i] == b[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+/// @brief Equality operator for packed SetN containers: compares keys
+/// @relates SetN
+	template<typename T, int N>
+	bool operator==(SetN<T, N, true> const& a, SetN<T, N, true> const& b) {
+		return a.key() == b.key();
+	}
+
+/// @brief Hash function for SetN containers, for use with boost::hash
+/// and boost::unordered containers.
+/// @relates SetN
+	template<typename T, int N>
+	std::size_t hash_value(SetN<T, N, false> const& v) {
+		std::size_t seed = 0;
+		for (int i = 0; i < N; ++i) {
+			boost::hash_combine(seed, v[i]);
+		}
+		return seed;
+	}
+
+/// @brief Hash function for packed SetN containers: mixes the packed key.
+/// @relates SetN
+	template<typename T, int N>
+	std::size_t hash_value(SetN<T, N, true> const& v) {
+		return detail::set2MixKey(v.key());
+	}
+
+/// @}
+
+} // end of namespace util
+
+#if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL)
+namespace std {
+	/// @brief std::hash support for SetN, forwarding to util::hash_value
+	template<typename T, int N, bool Packed>
+	struct hash< ::util::SetN<T, N, Packed> > {
+		std::size_t operator()(::util::SetN<T, N, Packed> const& v) const {
+			return ::util::hash_value(v);
+		}
+	};
+} // end of namespace std
+#endif
+
+#endif // INCLUDED_SetN_h_GUID_a486b9c8_ae88_45e2_bc4b_6b9ddd42071a
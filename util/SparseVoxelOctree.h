@@ -0,0 +1,640 @@
+/** @file
+	@brief Header providing a sparse voxel octree for occupancy queries over
+	large point sets.
+
+	A child of an octree node is addressed by a Cube::Vertex: bit 0 of the
+	vertex ID selects the upper half in x, bit 1 in y and bit 2 in z. A
+	voxel's Morton code is the sequence of those 3-bit IDs from the root
+	down, so sorting points by Morton code sorts them in depth-first tree
+	order, and the tree can be built bottom-up from the sorted codes.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_SparseVoxelOctree_h_GUID_c8021690_ad53_4262_8420_f0e3176febac
+#define INCLUDED_SparseVoxelOctree_h_GUID_c8021690_ad53_4262_8420_f0e3176febac
+
+// Internal Includes
+#include <util/CubeComponents.h>
+#include <util/RadixSort.h>
+#include <util/booststdint.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+#include <boost/thread/thread.hpp>
+
+// Standard includes
+#include <vector>
+#include <bitset>
+#include <cmath>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+
+namespace util {
+
+	/// @addtogroup Math Math Utilities
+	/// @{
+
+	namespace detail {
+		/// @internal
+		/// @brief Spread the low 21 bits of x out to every third bit.
+		inline stdint::uint64_t mortonSpread(stdint::uint64_t x) {
+			x &= 0x1fffffULL;
+			x = (x | x << 32) & 0x1f00000000ffffULL;
+			x = (x | x << 16) & 0x1f0000ff0000ffULL;
+			x = (x | x << 8) & 0x100f00f00f00f00fULL;
+			x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+			x = (x | x << 2) & 0x1249249249249249ULL;
+			return x;
+		}
+
+		/// @internal
+		/// @brief Inverse of mortonSpread.
+		inline stdint::uint64_t mortonCompact(stdint::uint64_t x) {
+			x &= 0x1249249249249249ULL;
+			x = (x | x >> 2) & 0x10c30c30c30c30c3ULL;
+			x = (x | x >> 4) & 0x100f00f00f00f00fULL;
+			x = (x | x >> 8) & 0x1f0000ff0000ffULL;
+			x = (x | x >> 16) & 0x1f00000000ffffULL;
+			x = (x | x >> 32) & 0x1fffffULL;
+			return x;
+		}
+
+		/// @internal
+		/// @brief Runs (owner.*step)(i) for i in [0, count), each on its own
+		/// thread unless count is 1.
+		template<typename Owner>
+		class OctreeStepTask {
+			public:
+				typedef void (Owner::*StepType)(unsigned int);
+
+				OctreeStepTask(Owner & owner, StepType step, unsigned int index)
+					: _owner(&owner)
+					, _step(step)
+					, _index(index)
+				{}
+
+				void operator()() const {
+					(_owner->*_step)(_index);
+				}
+
+			private:
+				Owner * _owner;
+				StepType _step;
+				unsigned int _index;
+		};
+
+		/// @internal
+		template<typename Owner>
+		void octreeRunSteps(Owner & owner, typename OctreeStepTask<Owner>::StepType step, unsigned int count) {
+			if (count == 1) {
+				(owner.*step)(0);
+				return;
+			}
+			boost::thread_group group;
+			for (unsigned int i = 0; i < count; ++i) {
+				group.create_thread(OctreeStepTask<Owner>(owner, step, i));
+			}
+			group.join_all();
+		}
+
+		/** @internal
+			@brief Parallel radix sort of Morton codes.
+
+			The codes are first scattered into 256 buckets by their top 8
+			bits, with each thread counting and then scattering its own
+			chunk of the input. Threads then radix sort contiguous runs of
+			buckets of about equal total size.
+		*/
+		class MortonCodeSorter {
+			public:
+				typedef stdint::uint64_t CodeType;
+
+				/// @param bits Number of significant bits in the codes: any
+				/// with bits above these set sort within the last bucket.
+				MortonCodeSorter(std::vector<CodeType> & codes, unsigned int bits, unsigned int threads)
+					: _codes(codes)
+					, _shift(bits > 8 ? bits - 8 : 0)
+					, _threads(std::max(1u, threads))
+					, _counts(_threads * 256, 0)
+					, _bucketBegin(257, 0)
+					, _threadBuckets(_threads + 1, 0)
+				{}
+
+				void sort() {
+					const std::size_t n = _codes.size();
+					if (n < 2) {
+						return;
+					}
+					_scratch.resize(n);
+					octreeRunSteps(*this, &MortonCodeSorter::_countStep, _threads);
+
+					/// Turn per-thread counts into per-thread scatter offsets
+					std::size_t offset = 0;
+					for (std::size_t b = 0; b < 256; ++b) {
+						_bucketBegin[b] = offset;
+						for (unsigned int t = 0; t < _threads; ++t) {
+							const std::size_t c = _counts[t * 256 + b];
+							_counts[t * 256 + b] = offset;
+							offset += c;
+						}
+					}
+					_bucketBegin[256] = offset;
+					octreeRunSteps(*this, &MortonCodeSorter::_scatterStep, _threads);
+
+					/// Split the buckets into runs of about n / threads codes
+					std::size_t b = 0;
+					for (unsigned int t = 1; t < _threads; ++t) {
+						const std::size_t target = n * t / _threads;
+						while (b < 256 && _bucketBegin[b + 1] <= target) {
+							++b;
+						}
+						_threadBuckets[t] = b;
+					}
+					_threadBuckets[_threads] = 256;
+					octreeRunSteps(*this, &MortonCodeSorter::_sortStep, _threads);
+					_codes.swap(_scratch);
+				}
+
+			private:
+				std::size_t _chunkBegin(unsigned int t) const {
+					return _codes.size() * t / _threads;
+				}
+
+				std::size_t _bucket(CodeType code) const {
+					return static_cast<std::size_t>(std::min(code >> _shift, CodeType(255)));
+				}
+
+				void _countStep(unsigned int t) {
+					std::size_t * count = &_counts[t * 256];
+					for (std::size_t i = _chunkBegin(t); i < _chunkBegin(t + 1); ++i) {
+						++count[_bucket(_codes[i])];
+					}
+				}
+
+				void _scatterStep(unsigned int t) {
+					std::size_t * offset = &_counts[t * 256];
+					for (std::size_t i = _chunkBegin(t); i < _chunkBegin(t + 1); ++i) {
+						const CodeType code = _codes[i];
+						_scratch[offset[_bucket(code)]++] = code;
+					}
+				}
+
+				void _sortStep(unsigned int t) {
+					for (std::size_t b = _threadBuckets[t]; b < _threadBuckets[t + 1]; ++b) {
+						const std::size_t begin = _bucketBegin[b];
+						const std::size_t size = _bucketBegin[b + 1] - begin;
+						if (size > 1) {
+							radixSort(&_scratch[begin], size, &_codes[begin]);
+						}
+					}
+				}
+
+				std::vector<CodeType> & _codes;
+				std::vector<CodeType> _scratch;
+				unsigned int _shift;
+				unsigned int _threads;
+				std::vector<std::size_t> _counts;
+				std::vector<std::size_t> _bucketBegin;
+				std::vector<std::size_t> _threadBuckets;
+		};
+	} // end of namespace detail
+
+	/** @brief A sparse voxel octree recording which voxels of a cubic
+		region hold points.
+
+		The region is a cube of the given size with its minimum corner at
+		the origin, divided into 2^depth voxels along each axis. Nodes live
+		in a single pool, level by level from the root, and each stores the
+		set of its children that exist as a Cube::Vertex bitmask, with those
+		children stored contiguously. Occupied voxels (leaves) are stored
+		in Morton order, along with how many points fell in each. Lookups
+		start from a direct table of the nodes MAX_DIRECT_LEVEL levels down,
+		so only the remaining levels are descended.
+
+		Voxels are identified by their Morton codes throughout; see
+		mortonEncode() and voxelCode().
+	*/
+	template<typename _VecType = Eigen::Vector3d>
+	class SparseVoxelOctree {
+		public:
+			typedef _VecType VectorType;
+			typedef typename VectorType::Scalar Scalar;
+			typedef CubeComponents::Cube<VectorType> CubeType;
+			typedef typename CubeType::Vertex Vertex;
+			typedef typename CubeType::Face Face;
+			typedef stdint::uint64_t CodeType;
+
+			/// The most levels a 64-bit Morton code can address
+			static const unsigned int MAX_DEPTH = 21;
+
+			/// The deepest level whose nodes are found by a direct table
+			/// lookup (of 8^level entries) rather than by descending the tree
+			static const unsigned int MAX_DIRECT_LEVEL = 6;
+
+			/// An interior node
+			struct Node {
+				/// Index of the first existing child: in the node pool, or
+				/// in the leaves for nodes on the last level
+				stdint::uint32_t firstChild;
+				/// Bit v is set if the child at Vertex v exists
+				unsigned char childMask;
+			};
+
+			/// @brief Constructor from the minimum corner and edge length of
+			/// the region, and the number of levels below the root (1 to
+			/// MAX_DEPTH).
+			SparseVoxelOctree(VectorType const& origin, Scalar size, unsigned int depth)
+				: _origin(origin)
+				, _size(size)
+				, _depth(depth)
+				, _levelBegin(depth + 1, 0)
+				, _directLevel(std::min(depth - 1, MAX_DIRECT_LEVEL)) {
+				if (depth < 1 || depth > MAX_DEPTH) {
+					throw std::out_of_range("Octree depth specified is out of range {1, ..., 21} !");
+				}
+				if (!(size > 0)) {
+					throw std::invalid_argument("Octree size must be positive!");
+				}
+			}
+
+			unsigned int depth() const {
+				return _depth;
+			}
+
+			/// @brief Number of voxels along each axis
+			stdint::uint32_t resolution() const {
+				return stdint::uint32_t(1) << _depth;
+			}
+
+			Scalar voxelSize() const {
+				return _size / resolution();
+			}
+
+			/// @brief Morton code of the voxel with the given integer coordinates
+			static CodeType mortonEncode(stdint::uint32_t x, stdint::uint32_t y, stdint::uint32_t z) {
+				return detail::mortonSpread(x) | (detail::mortonSpread(y) << 1) | (detail::mortonSpread(z) << 2);
+			}
+
+			/// @brief Integer coordinate along axis of the voxel with the given Morton code
+			static stdint::uint32_t mortonDecode(CodeType code, unsigned int axis) {
+				return static_cast<stdint::uint32_t>(detail::mortonCompact(code >> axis));
+			}
+
+			/// @brief The child taken at the given level (0 being the root)
+			/// on the way down to a voxel: level must be less than depth().
+			Vertex childVertex(CodeType code, unsigned int level) const {
+				assert(level < _depth);
+				return Vertex(typename Vertex::BitsetType((code >> (3 * (_depth - 1 - level))) & 7));
+			}
+
+			/// @brief Get the code of the voxel containing p.
+			/// @returns false if p is outside the octree.
+			bool voxelCode(VectorType const& p, CodeType & code) const {
+				const Scalar scale = resolution() / _size;
+				const Scalar limit = Scalar(resolution());
+				stdint::uint32_t c[3];
+				for (int i = 0; i < 3; ++i) {
+					const Scalar v = std::floor((p[i] - _origin[i]) * scale);
+					if (!(v >= 0 && v < limit)) {
+						return false;
+					}
+					c[i] = static_cast<stdint::uint32_t>(v);
+				}
+				code = mortonEncode(c[0], c[1], c[2]);
+				return true;
+			}
+
+			/// @brief Center of the voxel with the given code
+			VectorType voxelCenter(CodeType code) const {
+				VectorType p;
+				for (int i = 0; i < 3; ++i) {
+					p[i] = _origin[i] + (mortonDecode(code, i) + Scalar(0.5)) * voxelSize();
+				}
+				return p;
+			}
+
+			/** @brief Replace the contents with the voxels holding the n
+				given points, using up to threads threads.
+
+				@returns the number of points that fell inside the octree:
+				others are ignored.
+			*/
+			std::size_t build(VectorType const* points, std::size_t n, unsigned int threads = 1) {
+				threads = std::max(1u, threads);
+				std::vector<CodeType> codes(n);
+				{
+					Encoder encoder(*this, points, codes, threads);
+					detail::octreeRunSteps(encoder, &Encoder::step, threads);
+				}
+				detail::MortonCodeSorter(codes, 3 * _depth, threads).sort();
+
+				/// Points outside sort last, with an invalid code
+				const std::size_t inside = std::lower_bound(codes.begin(), codes.end(), _invalidCode()) - codes.begin();
+				_leafCodes.clear();
+				_leafCounts.clear();
+				for (std::size_t i = 0; i < inside; ++i) {
+					if (_leafCodes.empty() || _leafCodes.back() != codes[i]) {
+						_leafCodes.push_back(codes[i]);
+						_leafCounts.push_back(0);
+					}
+					++_leafCounts.back();
+				}
+				_buildNodes();
+				return inside;
+			}
+
+			/// @overload
+			std::size_t build(std::vector<VectorType> const& points, unsigned int threads = 1) {
+				return points.empty() ? build(NULL, 0, threads) : build(&points[0], points.size(), threads);
+			}
+
+			/// @name Occupancy
+			/// @{
+			/// @brief Index of the leaf for the voxel with the given code, or
+			/// -1 if the voxel is empty.
+			std::ptrdiff_t findLeaf(CodeType code) const {
+				if (_nodes.empty() || code >= _invalidCode()) {
+					return -1;
+				}
+				/// Jump straight to the node on the direct level, then descend
+				std::size_t n = _direct[code >> (3 * (_depth - _directLevel))];
+				if (n == NO_NODE) {
+					return -1;
+				}
+				for (int level = _depth - 1 - _directLevel; level >= 0; --level) {
+					Node const& node = _nodes[n];
+					const unsigned int v = (code >> (3 * level)) & 7;
+					if (!(node.childMask & (1u << v))) {
+						return -1;
+					}
+					n = node.firstChild + std::bitset<8>(node.childMask & ((1u << v) - 1)).count();
+				}
+				return n;
+			}
+
+			bool occupied(CodeType code) const {
+				return findLeaf(code) >= 0;
+			}
+
+			/// @brief Whether the voxel containing p holds any points
+			bool occupied(VectorType const& p) const {
+				CodeType code;
+				return voxelCode(p, code) && occupied(code);
+			}
+			/// @}
+
+			/// @name Adjacency
+			/// @brief Neighbors are found by stepping the Morton code directly,
+			/// one axis at a time, without decoding it.
+			/// @{
+			/// @brief Code of the voxel sharing face f of the given voxel.
+			/// @returns false if that is outside the octree.
+			bool faceNeighbor(CodeType code, Face const& f, CodeType & neighbor) const {
+				neighbor = code;
+				return _step(neighbor, f.getFixedBitIndex(), f.getFixedBitValue());
+			}
+
+			/// @brief Code of the voxel sharing only the corner at vertex v
+			/// of the given voxel.
+			/// @returns false if that is outside the octree.
+			bool vertexNeighbor(CodeType code, Vertex const& v, CodeType & neighbor) const {
+				neighbor = code;
+				return _step(neighbor, 0, v.getBitset()[0]) && _step(neighbor, 1, v.getBitset()[1]) && _step(neighbor, 2, v.getBitset()[2]);
+			}
+
+			/// @brief Bit f is set if the neighbor across Face f is occupied
+			unsigned char faceNeighborMask(CodeType code) const {
+				unsigned char mask = 0;
+				CodeType neighbor;
+				for (typename CubeType::IDType f = 0; f < Face::COUNT; ++f) {
+					if (faceNeighbor(code, Face(f), neighbor) && occupied(neighbor)) {
+						mask |= 1 << f;
+					}
+				}
+				return mask;
+			}
+
+			/// @brief Bit v is set if the neighbor across Vertex v is occupied
+			unsigned char vertexNeighborMask(CodeType code) const {
+				unsigned char mask = 0;
+				CodeType neighbor;
+				for (typename CubeType::IDType v = 0; v < Vertex::COUNT; ++v) {
+					if (vertexNeighbor(code, Vertex(v), neighbor) && occupied(neighbor)) {
+						mask |= 1 << v;
+					}
+				}
+				return mask;
+			}
+			/// @}
+
+			/// @name Leaves, in Morton order
+			/// @{
+			std::size_t leafCount() const {
+				return _leafCodes.size();
+			}
+
+			CodeType leafCode(std::size_t i) const {
+				return _leafCodes[i];
+			}
+
+			/// @brief Number of points in leaf i
+			stdint::uint32_t leafPointCount(std::size_t i) const {
+				return _leafCounts[i];
+			}
+
+			std::vector<CodeType> const& leafCodes() const {
+				return _leafCodes;
+			}
+			/// @}
+
+			/// @name Interior nodes
+			/// @{
+			/// @brief Number of nodes in the pool: the root is node 0 (when
+			/// there are any leaves).
+			std::size_t nodeCount() const {
+				return _nodes.size();
+			}
+
+			Node const& node(std::size_t i) const {
+				return _nodes[i];
+			}
+
+			/// @brief Index in the pool of the first node at the given level
+			/// (0 being the root): the nodes of a level are contiguous, in
+			/// Morton order.
+			std::size_t levelBegin(unsigned int level) const {
+				return _levelBegin[level];
+			}
+
+			/// @brief Index of the child at Vertex v of node n (a node, or a
+			/// leaf if n is on the last level), or -1 if it does not exist.
+			std::ptrdiff_t child(std::size_t n, Vertex const& v) const {
+				Node const& parent = _nodes[n];
+				const unsigned int id = v.getID();
+				if (!(parent.childMask & (1u << id))) {
+					return -1;
+				}
+				return parent.firstChild + std::bitset<8>(parent.childMask & ((1u << id) - 1)).count();
+			}
+			/// @}
+
+		private:
+			class Encoder;
+			friend class Encoder;
+
+			/// @brief Computes the codes for a chunk of points per thread
+			class Encoder {
+				public:
+					Encoder(SparseVoxelOctree const& tree, VectorType const* points, std::vector<CodeType> & codes, unsigned int threads)
+						: _tree(tree)
+						, _points(points)
+						, _codes(codes)
+						, _threads(threads)
+					{}
+
+					void step(unsigned int t) {
+						const std::size_t begin = _codes.size() * t / _threads;
+						const std::size_t end = _codes.size() * (t + 1) / _threads;
+						for (std::size_t i = begin; i < end; ++i) {
+							if (!_tree.voxelCode(_points[i], _codes[i])) {
+								_codes[i] = _tree._invalidCode();
+							}
+						}
+					}
+
+				private:
+					SparseVoxelOctree const& _tree;
+					VectorType const* _points;
+					std::vector<CodeType> & _codes;
+					unsigned int _threads;
+			};
+
+			/// Entry in the direct table for a node that does not exist
+			static const stdint::uint32_t NO_NODE = 0xffffffffu;
+
+			/// @brief Smallest code with a bit beyond the octree depth set
+			CodeType _invalidCode() const {
+				return CodeType(1) << (3 * _depth);
+			}
+
+			/// @brief Step code by one voxel along axis, up if positive.
+			bool _step(CodeType & code, unsigned int axis, bool positive) const {
+				const CodeType axisBits = (0x1249249249249249ULL << axis) & (_invalidCode() - 1);
+				const CodeType own = code & axisBits;
+				if (positive) {
+					if (own == axisBits) {
+						return false;
+					}
+					/// Filling the other bits with ones makes the carry skip them
+					code = (((code | ~axisBits) + 1) & axisBits) | (code & ~axisBits);
+				} else {
+					if (own == 0) {
+						return false;
+					}
+					code = ((own - 1) & axisBits) | (code & ~axisBits);
+				}
+				return true;
+			}
+
+			/// @brief Build the node pool bottom-up from the sorted leaf codes.
+			void _buildNodes() {
+				_nodes.clear();
+				_direct.clear();
+				std::fill(_levelBegin.begin(), _levelBegin.end(), 0);
+				if (_leafCodes.empty()) {
+					return;
+				}
+				_direct.resize(std::size_t(1) << (3 * _directLevel), NO_NODE);
+				std::vector<std::vector<Node> > levels(_depth);
+				std::vector<CodeType> childCodes(_leafCodes);
+				std::vector<CodeType> parentCodes;
+				for (int level = _depth - 1; level >= 0; --level) {
+					std::vector<Node> & nodes = levels[level];
+					parentCodes.clear();
+					for (std::size_t i = 0; i < childCodes.size(); ++i) {
+						const CodeType parent = childCodes[i] >> 3;
+						if (parentCodes.empty() || parentCodes.back() != parent) {
+							parentCodes.push_back(parent);
+							Node node = {static_cast<stdint::uint32_t>(i), 0};
+							nodes.push_back(node);
+						}
+						nodes.back().childMask |= 1 << (childCodes[i] & 7);
+					}
+					if (level == int(_directLevel)) {
+						/// Level-local indices for now: offset below
+						for (std::size_t i = 0; i < parentCodes.size(); ++i) {
+							_direct[parentCodes[i]] = static_cast<stdint::uint32_t>(i);
+						}
+					}
+					childCodes.swap(parentCodes);
+				}
+
+				std::size_t total = 0;
+				for (unsigned int level = 0; level < _depth; ++level) {
+					_levelBegin[level] = total;
+					total += levels[level].size();
+				}
+				_levelBegin[_depth] = total;
+				_nodes.reserve(total);
+				for (unsigned int level = 0; level < _depth; ++level) {
+					/// Children on the next level are offset by where it starts in the pool
+					const std::size_t childOffset = level + 1 < _depth ? _levelBegin[level + 1] : 0;
+					for (std::size_t i = 0; i < levels[level].size(); ++i) {
+						Node node = levels[level][i];
+						node.firstChild += static_cast<stdint::uint32_t>(childOffset);
+						_nodes.push_back(node);
+					}
+				}
+				for (std::size_t i = 0; i < _direct.size(); ++i) {
+					if (_direct[i] != NO_NODE) {
+						_direct[i] += static_cast<stdint::uint32_t>(_levelBegin[_directLevel]);
+					}
+				}
+			}
+
+			VectorType _origin;
+			Scalar _size;
+			unsigned int _depth;
+			std::vector<Node> _nodes;
+			std::vector<std::size_t> _levelBegin;
+			unsigned int _directLevel;
+			/// Pool index of each node on the direct level, by its code
+			std::vector<stdint::uint32_t> _direct;
+			std::vector<CodeType> _leafCodes;
+			std::vector<stdint::uint32_t> _leafCounts;
+	};
+
+	/// Definitions of the static constants, for when they are bound to a
+	/// reference (std::min, std::vector::resize) in unoptimized builds.
+	template<typename _VecType>
+	const unsigned int SparseVoxelOctree<_VecType>::MAX_DEPTH;
+
+	template<typename _VecType>
+	const unsigned int SparseVoxelOctree<_VecType>::MAX_DIRECT_LEVEL;
+
+	template<typename _VecType>
+	const stdint::uint32_t SparseVoxelOctree<_VecType>::NO_NODE;
+
+	/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_SparseVoxelOctree_h_GUID_c8021690_ad53_4262_8420_f0e3176febac
@@ -0,0 +1,223 @@
+/** @file
+	@brief Header providing batched trilinear weights and interpolation
+	over the corners of a cube, as numbered by CubeComponents.
+
+	Batches are structure-of-arrays: Eigen arrays with one row per
+	coordinate (or weight, or channel) and one column per point, stored
+	row-major so that each row is one contiguous stream that Eigen
+	processes with SIMD packets.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_TrilinearInterpolation_h_GUID_97c4cc92_cc8d_4394_acff_e272b6a25282
+#define INCLUDED_TrilinearInterpolation_h_GUID_97c4cc92_cc8d_4394_acff_e272b6a25282
+
+// Internal Includes
+#include <util/CubeComponents.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+
+// Standard includes
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+
+namespace util {
+
+	/// @addtogroup Math Math Utilities
+	/// @{
+
+	/** @brief Trilinear weights of the 8 cube vertices, in Vertex ID order,
+		for a point with local coordinates t in [0, 1]^3.
+
+		t = 0 along an axis is the side of the cube where Vertex::get() is
+		-1, so the weights reproduce the point itself:
+		Cube<>::getCorners() * weights == 2 * t - 1.
+	*/
+	template<typename Derived>
+	inline Eigen::Matrix<typename Derived::Scalar, 8, 1> trilinearWeights(Eigen::MatrixBase<Derived> const& t) {
+		typedef typename Derived::Scalar Scalar;
+		const Scalar u[3] = {1 - t[0], 1 - t[1], 1 - t[2]};
+		Eigen::Matrix<Scalar, 8, 1> weights;
+		/// The same order of operations as the batch version
+		weights[0] = u[0] * u[1];
+		weights[1] = t[0] * u[1];
+		weights[2] = u[0] * t[1];
+		weights[3] = t[0] * t[1];
+		for (int v = 0; v < 4; ++v) {
+			weights[v + 4] = weights[v] * t[2];
+			weights[v] *= u[2];
+		}
+		return weights;
+	}
+
+	/** @brief Batch trilinearWeights(): t is 3 x n local coordinates, and
+		weights receives 8 x n weights.
+
+		Both should be row-major arrays (or blocks of them), so every
+		operation here runs along contiguous rows.
+	*/
+	template<typename DerivedT, typename DerivedW>
+	inline void trilinearWeights(Eigen::ArrayBase<DerivedT> const& t, Eigen::ArrayBase<DerivedW> const& weightsOut) {
+		typedef typename DerivedT::Scalar Scalar;
+		/// Output through a const reference so blocks can be written (the Eigen idiom)
+		DerivedW & weights = const_cast<Eigen::ArrayBase<DerivedW> &>(weightsOut).derived();
+		weights.row(0) = (Scalar(1) - t.row(0)) * (Scalar(1) - t.row(1));
+		weights.row(1) = t.row(0) * (Scalar(1) - t.row(1));
+		weights.row(2) = (Scalar(1) - t.row(0)) * t.row(1);
+		weights.row(3) = t.row(0) * t.row(1);
+		for (int v = 0; v < 4; ++v) {
+			weights.row(v + 4) = weights.row(v) * t.row(2);
+			weights.row(v) *= Scalar(1) - t.row(2);
+		}
+	}
+
+	/** @brief Batch blend of values at the 8 cube vertices: row v of
+		values and weights belong to Vertex v, and result receives the
+		weighted sum for each column.
+	*/
+	template<typename DerivedV, typename DerivedW, typename DerivedR>
+	inline void trilinearBlend(Eigen::ArrayBase<DerivedV> const& values, Eigen::ArrayBase<DerivedW> const& weights,
+	                           Eigen::ArrayBase<DerivedR> const& resultOut) {
+		DerivedR & result = const_cast<Eigen::ArrayBase<DerivedR> &>(resultOut).derived();
+		result = values.row(0) * weights.row(0);
+		for (int v = 1; v < 8; ++v) {
+			result += values.row(v) * weights.row(v);
+		}
+	}
+
+	/** @brief Trilinear sampling of a field on a dense grid, one point or
+		many at a time.
+
+		The grid holds Channels interleaved values per sample (1 for a
+		scalar field, 3 for a vector field, ...), with x varying fastest,
+		then y, then z. Sample (i, j, k) sits at origin + spacing .* (i, j, k).
+		Points outside the grid are clamped to its boundary, and a NaN
+		coordinate is clamped like one below the origin. The grid is not
+		copied: it must outlive the sampler.
+	*/
+	template<typename _Scalar, int Channels = 1>
+	class TrilinearGridSampler {
+		public:
+			typedef _Scalar Scalar;
+			typedef Eigen::Matrix<Scalar, 3, 1> VectorType;
+			typedef Eigen::Matrix<Scalar, Channels, 1> ValueType;
+			/// 3 x n points, one coordinate per row
+			typedef Eigen::Array<Scalar, 3, Eigen::Dynamic, Eigen::RowMajor> PointsType;
+			/// Channels x n sampled values, one channel per row
+			typedef Eigen::Array<Scalar, Channels, Eigen::Dynamic, Eigen::RowMajor> ValuesType;
+
+			/// Points processed together by the batch sample(), sized for the L1 cache
+			static const int BLOCK = 256;
+
+			TrilinearGridSampler(Scalar const* values, Eigen::Vector3i const& dims,
+			                     VectorType const& origin = VectorType::Zero(),
+			                     VectorType const& spacing = VectorType::Ones())
+				: _values(values)
+				, _dims(dims)
+				, _origin(origin)
+				, _invSpacing(spacing.cwiseInverse()) {
+				if (!values) {
+					throw std::invalid_argument("Trilinear sampling needs grid values!");
+				}
+				if (dims[0] < 2 || dims[1] < 2 || dims[2] < 2) {
+					throw std::invalid_argument("Trilinear sampling needs at least 2 samples along each axis!");
+				}
+				const std::size_t stride[3] = {1, std::size_t(dims[0]), std::size_t(dims[0]) * dims[1]};
+				for (int v = 0; v < 8; ++v) {
+					_cornerOffset[v] = Channels * ((v & 1) * stride[0] + ((v >> 1) & 1) * stride[1] + (v >> 2) * stride[2]);
+				}
+			}
+
+			/// @brief Sample the field at one point
+			ValueType sample(VectorType const& p) const {
+				VectorType t;
+				const std::size_t base = _locate(p, t);
+				const Eigen::Matrix<Scalar, 8, 1> weights = trilinearWeights(t);
+				ValueType result;
+				for (int k = 0; k < Channels; ++k) {
+					result[k] = _values[base + k] * weights[0];
+					for (int v = 1; v < 8; ++v) {
+						result[k] += _values[base + _cornerOffset[v] + k] * weights[v];
+					}
+				}
+				return result;
+			}
+
+			/// @brief Sample the field at each column of points
+			template<typename DerivedP>
+			void sample(Eigen::ArrayBase<DerivedP> const& points, ValuesType & result) const {
+				const Eigen::DenseIndex n = points.cols();
+				result.resize(Channels, n);
+				Eigen::Array<Scalar, 3, BLOCK, Eigen::RowMajor> t;
+				Eigen::Array<Scalar, 8, BLOCK, Eigen::RowMajor> weights;
+				Eigen::Array<Scalar, 8, BLOCK, Eigen::RowMajor> corners;
+				std::size_t base[BLOCK];
+				for (Eigen::DenseIndex start = 0; start < n; start += BLOCK) {
+					const Eigen::DenseIndex m = std::min<Eigen::DenseIndex>(BLOCK, n - start);
+					for (Eigen::DenseIndex j = 0; j < m; ++j) {
+						VectorType local;
+						base[j] = _locate(points.col(start + j).matrix(), local);
+						t.col(j) = local.array();
+					}
+					trilinearWeights(t.leftCols(m), weights.leftCols(m));
+					for (int k = 0; k < Channels; ++k) {
+						for (int v = 0; v < 8; ++v) {
+							Scalar const* corner = _values + _cornerOffset[v] + k;
+							for (Eigen::DenseIndex j = 0; j < m; ++j) {
+								corners(v, j) = corner[base[j]];
+							}
+						}
+						trilinearBlend(corners.leftCols(m), weights.leftCols(m), result.row(k).segment(start, m));
+					}
+				}
+			}
+
+		private:
+			/// @brief Find the cell holding p: returns the index of its first
+			/// value, and sets t to the local coordinates of p in it.
+			std::size_t _locate(VectorType const& p, VectorType & t) const {
+				std::size_t cell[3];
+				for (int i = 0; i < 3; ++i) {
+					/// Written so a NaN coordinate fails the first test and clamps to 0
+					Scalar g = (p[i] - _origin[i]) * _invSpacing[i];
+					if (!(g > 0)) {
+						g = 0;
+					} else if (g > Scalar(_dims[i] - 1)) {
+						g = Scalar(_dims[i] - 1);
+					}
+					cell[i] = std::min(static_cast<std::size_t>(g), std::size_t(_dims[i] - 2));
+					t[i] = g - Scalar(cell[i]);
+				}
+				return Channels * (cell[0] + _dims[0] * (cell[1] + std::size_t(_dims[1]) * cell[2]));
+			}
+
+			Scalar const* _values;
+			Eigen::Vector3i _dims;
+			VectorType _origin;
+			VectorType _invSpacing;
+			std::size_t _cornerOffset[8];
+	};
+
+	/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_TrilinearInterpolation_h_GUID_97c4cc92_cc8d_4394_acff_e272b6a25282
@@ -26,10 +26,13 @@
 // - none
 
 // Library/third-party includes
-// - none
+#include <boost/config.hpp>
 
 // Standard includes
 #include <algorithm>
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+#include <utility>
+#endif
 
 namespace util {
 
@@ -43,7 +46,9 @@ namespace util {
 		some simulation.
 
 		Works nicely holding STL containers, as well as other "value-type" objects:
-		that is, things that aren't complicated and pointer-y.
+		that is, things that aren't complicated and pointer-y. For containers,
+		advanceReuse() and advanceByCopy() both recycle the storage of the
+		old previous value, so a steady state never reallocates.
 
 		@tparam T Contained type.
 	*/
@@ -80,14 +85,14 @@ namespace util {
 
 			/// Value constructor: creates current value by copy construction,
 			/// and previous value by default construction
-			explicit WithHistory(T curVal) :
+			explicit WithHistory(T const& curVal) :
 				_a(curVal),
 				_current(&_a),
 				_previous(&_b) { }
 
 			/// Value constructor: creates current and previous values
 			/// by copy construction.
-			WithHistory(T curVal, T prevVal) :
+			WithHistory(T const& curVal, T const& prevVal) :
 				_a(curVal),
 				_b(prevVal),
 				_current(&_a),
@@ -95,10 +100,34 @@ namespace util {
 
 			/// Copy constructor
 			WithHistory(WithHistory const& other) :
-				_a(other._a),
-				_b(other._b),
+				_a(other.current()),
+				_b(other.previous()),
+				_current(&_a),
+				_previous(&_b) { }
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+			/// Value constructor: creates current value by move construction,
+			/// and previous value by default construction
+			explicit WithHistory(T && curVal) :
+				_a(std::move(curVal)),
+				_current(&_a),
+				_previous(&_b) { }
+
+			/// Value constructor: creates current and previous values
+			/// by move construction.
+			WithHistory(T && curVal, T && prevVal) :
+				_a(std::move(curVal)),
+				_b(std::move(prevVal)),
+				_current(&_a),
+				_previous(&_b) { }
+
+			/// Move constructor
+			WithHistory(WithHistory && other) :
+				_a(std::move(*other._current)),
+				_b(std::move(*other._previous)),
 				_current(&_a),
 				_previous(&_b) { }
+#endif
 
 			/// Assignment operator
 			WithHistory & operator=(WithHistory const& other) {
@@ -108,6 +137,7 @@ namespace util {
 				}
 				current() = other.current();
 				previous() = other.previous();
+				return *this;
 			}
 
 			/// Accessor for current value - can be used as an l-value
@@ -149,6 +179,29 @@ namespace util {
 				swap();
 			}
 
+			/// Advance history, clearing the new current value in place.
+			///
+			/// Make previous() return what current() returns now, and make
+			/// the new "current()" the old previous value after calling its
+			/// clear() member. For containers and strings this keeps the
+			/// allocated capacity, so refilling it does not allocate unless it
+			/// grows beyond any earlier size.
+			void advanceReuse() {
+				swap();
+				_current->clear();
+			}
+
+			/// Advance history, resetting the new current value in place.
+			///
+			/// Like advanceReuse(), but calls f(current(), previous()) instead
+			/// of clear(), for types without clear() or when the new value
+			/// should start out other than empty.
+			template<typename ResetFunctor>
+			void advanceWithReset(ResetFunctor f) {
+				swap();
+				f(*_current, static_cast<value_const_ref_type>(*_previous));
+			}
+
 	};
 
 /// @}
@@ -0,0 +1,173 @@
+/** @file
+	@brief Fixed-depth, non-allocating history ring generalizing WithHistory.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_WithHistoryN_h_GUID_d4a07811_17c2_43ca_8f2e_dc63751dab8c
+#define INCLUDED_WithHistoryN_h_GUID_d4a07811_17c2_43ca_8f2e_dc63751dab8c
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <util/BoostAssertMsg.h>
+
+// Standard includes
+#include <cstddef>
+
+namespace util {
+
+/// @addtogroup DataStructures Data Structures
+/// @{
+	/** @brief Container class for a value varying over time, keeping the
+		last N values: a generalization of WithHistory for filters that
+		need more than one prior value.
+
+		All N values are stored inline, and advancing only rotates an index,
+		so nothing is copied or allocated after construction unless you ask
+		for it with advanceByCopy().
+
+		@tparam T Contained type.
+		@tparam N Number of values kept, including the current one.
+	*/
+	template<typename T, std::size_t N>
+	class WithHistoryN {
+			BOOST_STATIC_ASSERT_MSG(N >= 2, "WithHistoryN must keep at least two values");
+		public:
+			/// Contained value type
+			typedef T value_type;
+
+			/// Reference to contained value type
+			typedef T & value_ref_type;
+
+			/// Reference to const contained value type
+			typedef T const& value_const_ref_type;
+
+			enum {
+				DEPTH = N
+			};
+
+			/// Default constructor: creates all values by default construction
+			WithHistoryN()
+				: _current(0) { }
+
+			/// Value constructor: creates current value by copy,
+			/// and older values by default construction
+			explicit WithHistoryN(T const& curVal)
+				: _current(0) {
+				_values[0] = curVal;
+			}
+
+			/// Value constructor: creates current value and all
+			/// older values by copy.
+			WithHistoryN(T const& curVal, T const& prevVal)
+				: _current(0) {
+				_values[0] = curVal;
+				for (std::size_t i = 1; i < N; ++i) {
+					_values[i] = prevVal;
+				}
+			}
+
+			/// Number of values kept, including the current one
+			static std::size_t depth() {
+				return N;
+			}
+
+			/// Accessor for a value in history: 0 is current, 1 is previous,
+			/// up to N - 1 for the oldest.
+			value_ref_type history(std::size_t k) {
+				BOOST_ASSERT_MSG(k < N, "History index out of range");
+				return _values[_index(k)];
+			}
+
+			/// Const accessor for a value in history
+			value_const_ref_type history(std::size_t k) const {
+				BOOST_ASSERT_MSG(k < N, "History index out of range");
+				return _values[_index(k)];
+			}
+
+			/// Accessor for current value - can be used as an l-value
+			value_ref_type current() {
+				return _values[_current];
+			}
+
+			/// Const accessor for current value
+			value_const_ref_type current() const {
+				return _values[_current];
+			}
+
+			/// Accessor for "previous" value, same as history(1)
+			value_ref_type previous() {
+				return history(1);
+			}
+
+			/// Const accessor for "previous" value
+			value_const_ref_type previous() const {
+				return history(1);
+			}
+
+			/// Advance history by rotation.
+			///
+			/// Every value moves one step back in history, and the oldest
+			/// value becomes current() without being modified. If you want
+			/// to start with a "clean" current value, it is your
+			/// responsibility to do so after this method.
+			void advance() {
+				_current = (_current == 0 ? N : _current) - 1;
+			}
+
+			/// Advance history by copying.
+			///
+			/// Like advance(), but initializes the new current() with a copy
+			/// of what current() returns now.
+			void advanceByCopy() {
+				advance();
+				current() = previous();
+			}
+
+			/// Advance history, resetting the new current value in place.
+			///
+			/// Like advance(), but then calls f(current(), previous()) so you
+			/// can reinitialize the recycled value (for instance, clearing a
+			/// container without releasing its storage) rather than paying
+			/// for a full copy.
+			template<typename ResetFunctor>
+			void advanceWithReset(ResetFunctor f) {
+				advance();
+				f(current(), static_cast<WithHistoryN const&>(*this).previous());
+			}
+
+		private:
+			/// Both operands are less than N, so a subtraction replaces modulo
+			std::size_t _index(std::size_t k) const {
+				const std::size_t i = _current + k;
+				return i >= N ? i - N : i;
+			}
+
+			T _values[N];
+			std::size_t _current;
+	};
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_WithHistoryN_h_GUID_d4a07811_17c2_43ca_8f2e_dc63751dab8c
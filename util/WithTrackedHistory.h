@@ -0,0 +1,287 @@
+/** @file
+	@brief Variant of WithHistory for large random-access containers,
+	where only modified elements are copied when history advances.
+
+	@versioninfo@
+
+	@date 2026
+
+	@author
+	Ryan Pavlik
+	<rpavlik@iastate.edu> and <abiryan@ryand.net>
+	http://academic.cleardefinition.com/
+	Iowa State University Virtual Reality Applications Center
+	Human-Computer Interaction Graduate Program
+*/
+
+//          Copyright Iowa State University 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef INCLUDED_WithTrackedHistory_h_GUID_3087e6b4_776e_452f_be95_48978344b97d
+#define INCLUDED_WithTrackedHistory_h_GUID_3087e6b4_776e_452f_be95_48978344b97d
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/assert.hpp>
+#include <util/BoostAssertMsg.h>
+
+// Standard includes
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+
+namespace util {
+
+/// @addtogroup DataStructures Data Structures
+/// @{
+	/** @brief Container class for a random-access container varying over
+		time, like WithHistory, that records which elements of the current
+		value are written so that advanceByCopy() copies only those.
+
+		Write elements through the tracked accessors write(), set() and
+		writeRange(): current() is read-only. Anything that could change the
+		current value in an untracked way (modifyCurrent(), swap(), or a
+		size change) marks the whole container dirty, so the next
+		advanceByCopy() falls back to a full copy, as it also does once the
+		written elements exceed a threshold fraction of the size.
+
+		@tparam Container A random-access container such as std::vector.
+	*/
+	template<typename Container>
+	class WithTrackedHistory {
+		public:
+			/// Contained value type
+			typedef Container value_type;
+
+			/// Reference to const contained value type
+			typedef Container const& value_const_ref_type;
+
+			typedef typename Container::size_type size_type;
+			typedef typename Container::reference reference;
+			typedef typename Container::iterator iterator;
+			typedef typename Container::value_type element_type;
+
+			/// Default constructor: creates previous and current values
+			/// by default construction
+			WithTrackedHistory()
+				: _current(&_a)
+				, _previous(&_b)
+				, _allDirty(false)
+				, _dirtyCount(0)
+				, _threshold(0.25) { }
+
+			/// Value constructor: creates current and previous values
+			/// by copy construction, so they start out equal.
+			explicit WithTrackedHistory(Container const& curVal)
+				: _a(curVal)
+				, _b(curVal)
+				, _current(&_a)
+				, _previous(&_b)
+				, _allDirty(false)
+				, _dirtyCount(0)
+				, _threshold(0.25) { }
+
+			/// Value constructor: creates current and previous values
+			/// by copy construction.
+			WithTrackedHistory(Container const& curVal, Container const& prevVal)
+				: _a(curVal)
+				, _b(prevVal)
+				, _current(&_a)
+				, _previous(&_b)
+				, _allDirty(true)
+				, _dirtyCount(0)
+				, _threshold(0.25) { }
+
+			/// Copy constructor
+			WithTrackedHistory(WithTrackedHistory const& other)
+				: _a(other.current())
+				, _b(other.previous())
+				, _current(&_a)
+				, _previous(&_b)
+				, _dirty(other._dirty)
+				, _written(other._written)
+				, _allDirty(other._allDirty)
+				, _dirtyCount(other._dirtyCount)
+				, _threshold(other._threshold) { }
+
+			/// Assignment operator
+			WithTrackedHistory & operator=(WithTrackedHistory const& other) {
+				if (this == &other) {
+					/// self-assign is a no-op
+					return *this;
+				}
+				*_current = other.current();
+				*_previous = other.previous();
+				_dirty = other._dirty;
+				_written = other._written;
+				_allDirty = other._allDirty;
+				_dirtyCount = other._dirtyCount;
+				_threshold = other._threshold;
+				return *this;
+			}
+
+			/// Const accessor for current value
+			value_const_ref_type current() const {
+				return *_current;
+			}
+
+			/// Untracked mutable accessor for current value: marks all elements
+			/// dirty. Prefer write(), set() or writeRange().
+			Container & modifyCurrent() {
+				markAllDirty();
+				return *_current;
+			}
+
+			/// Const accessor for "previous" value
+			value_const_ref_type previous() const {
+				return *_previous;
+			}
+
+			/// Tracked element accessor: returns a reference to element i of
+			/// the current value and records it as written.
+			reference write(size_type i) {
+				BOOST_ASSERT_MSG(i < _current->size(), "Element index out of range");
+				_record(i, i + 1);
+				return (*_current)[i];
+			}
+
+			/// Tracked element assignment
+			void set(size_type i, element_type const& v) {
+				write(i) = v;
+			}
+
+			/// Tracked range accessor: records elements [first, last) as
+			/// written and returns an iterator to element first.
+			iterator writeRange(size_type first, size_type last) {
+				BOOST_ASSERT_MSG(first <= last && last <= _current->size(), "Element range out of range");
+				_record(first, last);
+				return _current->begin() + first;
+			}
+
+			/// Record that every element may have changed.
+			void markAllDirty() {
+				_allDirty = true;
+				_dirty.clear();
+				_written.clear();
+				_dirtyCount = 0;
+			}
+
+			/// Whether the next advanceByCopy() will copy the whole container
+			bool willCopyAll() const {
+				return _allDirty || _current->size() != _previous->size();
+			}
+
+			/// Number of distinct elements recorded as written since the
+			/// last advance: writing one element again does not count twice.
+			size_type dirtyCount() const {
+				return _dirtyCount;
+			}
+
+			/// Set the fraction of the container size beyond which recorded
+			/// elements are abandoned in favor of one full copy (default 0.25)
+			void setFullCopyThreshold(double fraction) {
+				_threshold = fraction;
+			}
+
+			/// Advance history by a simple swap.
+			///
+			/// Make previous() return what current() returns now, and vice-versa.
+			/// Since the values may then differ anywhere, the next
+			/// advanceByCopy() performs a full copy.
+			void swap() {
+				std::swap(_current, _previous);
+				markAllDirty();
+			}
+
+			/// Advance history by copying.
+			///
+			/// Make previous() return a copy of what current() returns now.
+			/// Only the elements recorded as written since the last advance
+			/// are copied, unless the whole container was marked dirty.
+			void advanceByCopy() {
+				if (willCopyAll()) {
+					(*_previous) = (*_current);
+				} else {
+					for (typename std::vector<range_type>::const_iterator it = _dirty.begin(), e = _dirty.end(); it != e; ++it) {
+						std::copy(_current->begin() + it->first, _current->begin() + it->second, _previous->begin() + it->first);
+						std::fill(_written.begin() + it->first, _written.begin() + it->second, false);
+					}
+				}
+				_dirty.clear();
+				_dirtyCount = 0;
+				_allDirty = false;
+			}
+
+		private:
+			typedef std::pair<size_type, size_type> range_type;
+
+			void _record(size_type first, size_type last) {
+				if (_allDirty) {
+					return;
+				}
+				if (_written.size() != _current->size()) {
+					/// Size changes mark everything dirty, so this only
+					/// happens on the first write after a full copy.
+					_written.assign(_current->size(), false);
+				}
+				/// Record only the runs of elements not already written
+				size_type i = first;
+				while (i < last) {
+					while (i < last && _written[i]) {
+						++i;
+					}
+					const size_type runStart = i;
+					while (i < last && !_written[i]) {
+						_written[i] = true;
+						++i;
+					}
+					if (runStart == i) {
+						break;
+					}
+					_dirtyCount += i - runStart;
+					if (!_dirty.empty() && _dirty.back().second == runStart) {
+						/// Coalesce sequential writes into one range
+						_dirty.back().second = i;
+					} else {
+						_dirty.push_back(range_type(runStart, i));
+					}
+				}
+				if (_dirtyCount > _threshold * _current->size()) {
+					markAllDirty();
+				}
+			}
+
+			/// One of the contained values
+			Container _a;
+
+			/// The other contained value
+			Container _b;
+
+			/// Pointer to the contained value deemed "current"
+			Container * _current;
+
+			/// Pointer to the contained value deemed "previous"
+			Container * _previous;
+
+			/// Element ranges of the current value written since the last advance
+			std::vector<range_type> _dirty;
+
+			/// Which elements of the current value are in _dirty
+			std::vector<bool> _written;
+
+			bool _allDirty;
+			size_type _dirtyCount;
+			double _threshold;
+	};
+
+/// @}
+
+} // end of namespace util
+
+#endif // INCLUDED_WithTrackedHistory_h_GUID_3087e6b4_776e_452f_be95_48978344b97d